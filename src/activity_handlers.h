@@ -116,10 +116,12 @@ enum class item_drop_reason : int {
     tumbling
 };
 
-void put_into_vehicle_or_drop( Character &c, item_drop_reason, const std::list<item> &items );
-void put_into_vehicle_or_drop( Character &c, item_drop_reason, const std::list<item> &items,
+// These take the items by value and move them to their destination, pass an rvalue to avoid
+// copying them.
+void put_into_vehicle_or_drop( Character &c, item_drop_reason, std::list<item> items );
+void put_into_vehicle_or_drop( Character &c, item_drop_reason, std::list<item> items,
                                const tripoint &where, bool force_ground = false );
-void drop_on_map( Character &c, item_drop_reason reason, const std::list<item> &items,
+void drop_on_map( Character &c, item_drop_reason reason, std::list<item> items,
                   const tripoint &where );
 
 namespace activity_handlers
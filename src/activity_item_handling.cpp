@@ -186,7 +186,16 @@ static bool handle_spillable_contents( Character &c, item &it, map &m )
     return false;
 }
 
-static void put_into_vehicle( Character &c, item_drop_reason reason, const std::list<item> &items,
+// Putting down an item someone else owns only makes witnesses react, the item keeps its owner.
+// That is done on a copy, which is only needed in that case.
+static void handle_drop_ownership( Character &c, const item &it )
+{
+    if( c.is_avatar() && !it.is_owned_by( c ) && !it.get_owner().is_null() ) {
+        item( it ).handle_pickup_ownership( c );
+    }
+}
+
+static void put_into_vehicle( Character &c, item_drop_reason reason, std::list<item> items,
                               vehicle &veh, int part )
 {
     if( items.empty() ) {
@@ -199,8 +208,12 @@ static void put_into_vehicle( Character &c, item_drop_reason reason, const std::
     int fallen_count = 0;
     int into_vehicle_count = 0;
 
-    // can't use constant reference here because of the spill_contents()
-    for( item it : items ) {
+    // The messages describe the items as they were handed over, before they are moved away.
+    const bool all_same_type = same_type( items );
+    const int dropcount = all_same_type ? items.size() * items.front().count() : 0;
+    const std::string it_name = all_same_type ? items.front().tname( dropcount ) : std::string();
+
+    for( item &it : items ) {
         if( handle_spillable_contents( c, it, here ) ) {
             continue;
         }
@@ -210,8 +223,10 @@ static void put_into_vehicle( Character &c, item_drop_reason reason, const std::
             it.charges = 0;
         }
 
-        if( veh.add_item( part, it ) ) {
-            into_vehicle_count += it.count();
+        handle_drop_ownership( c, it );
+        const int count = it.count();
+        if( veh.add_item_by_move( part, it ) ) {
+            into_vehicle_count += count;
         } else {
             if( it.count_by_charges() ) {
                 // Maybe we can add a few charges in the trunk and the rest on the ground.
@@ -219,19 +234,14 @@ static void put_into_vehicle( Character &c, item_drop_reason reason, const std::
                 it.mod_charges( -charges_added );
                 into_vehicle_count += charges_added;
             }
-            here.add_item_or_charges( where, it );
             fallen_count += it.count();
+            here.add_item_or_charges( where, std::move( it ) );
         }
-        it.handle_pickup_ownership( c );
     }
 
     const std::string part_name = veh.part_info( part ).name();
 
-    if( same_type( items ) ) {
-        const item &it = items.front();
-        const int dropcount = items.size() * it.count();
-        const std::string it_name = it.tname( dropcount );
-
+    if( all_same_type ) {
         switch( reason ) {
             case item_drop_reason::deliberate:
                 c.add_msg_player_or_npc(
@@ -306,7 +316,7 @@ static void put_into_vehicle( Character &c, item_drop_reason reason, const std::
     }
 }
 
-void drop_on_map( Character &c, item_drop_reason reason, const std::list<item> &items,
+void drop_on_map( Character &c, item_drop_reason reason, std::list<item> items,
                   const tripoint &where )
 {
     if( items.empty() ) {
@@ -388,27 +398,27 @@ void drop_on_map( Character &c, item_drop_reason reason, const std::list<item> &
                 break;
         }
     }
-    for( const item &it : items ) {
-        here.add_item_or_charges( where, it );
-        item( it ).handle_pickup_ownership( c );
+    for( item &it : items ) {
+        handle_drop_ownership( c, it );
+        here.add_item_or_charges( where, std::move( it ) );
     }
 }
 
-void put_into_vehicle_or_drop( Character &c, item_drop_reason reason, const std::list<item> &items )
+void put_into_vehicle_or_drop( Character &c, item_drop_reason reason, std::list<item> items )
 {
-    return put_into_vehicle_or_drop( c, reason, items, c.pos() );
+    return put_into_vehicle_or_drop( c, reason, std::move( items ), c.pos() );
 }
 
-void put_into_vehicle_or_drop( Character &c, item_drop_reason reason, const std::list<item> &items,
+void put_into_vehicle_or_drop( Character &c, item_drop_reason reason, std::list<item> items,
                                const tripoint &where, bool force_ground )
 {
     map &here = get_map();
     const cata::optional<vpart_reference> vp = here.veh_at( where ).part_with_feature( "CARGO", false );
     if( vp && !force_ground ) {
-        put_into_vehicle( c, reason, items, vp->vehicle(), vp->part_index() );
+        put_into_vehicle( c, reason, std::move( items ), vp->vehicle(), vp->part_index() );
         return;
     }
-    drop_on_map( c, reason, items, where );
+    drop_on_map( c, reason, std::move( items ), where );
 }
 
 static std::list<act_item> convert_to_act_item( const player_activity &act, Character &guy )
@@ -687,16 +697,13 @@ static void move_item( player &p, item &it, const int quantity, const tripoint &
                        const tripoint &dest, vehicle *src_veh, int src_part,
                        const activity_id &activity_to_restore = activity_id::NULL_ID() )
 {
-    item leftovers = it;
-
-    if( quantity != 0 && it.count_by_charges() ) {
-        // Reinserting leftovers happens after item removal to avoid stacking issues.
+    // Only a partially moved stack needs a copy, for the part that stays behind.
+    // Reinserting leftovers happens after item removal to avoid stacking issues.
+    item leftovers;
+    if( quantity != 0 && it.count_by_charges() && it.charges > quantity ) {
+        leftovers = it;
         leftovers.charges = it.charges - quantity;
-        if( leftovers.charges > 0 ) {
-            it.charges = quantity;
-        }
-    } else {
-        leftovers.charges = 0;
+        it.charges = quantity;
     }
 
     map &here = get_map();
@@ -708,13 +715,14 @@ static void move_item( player &p, item &it, const int quantity, const tripoint &
         } else if( activity_to_restore == ACT_FETCH_REQUIRED ) {
             it.set_var( "activity_var", p.name );
         }
-        put_into_vehicle_or_drop( p, item_drop_reason::deliberate, { it }, dest );
-        // Remove from map or vehicle.
+        // Take it from the map or vehicle, then hand it over without copying.
+        std::list<item> moved;
         if( src_veh ) {
-            src_veh->remove_item( src_part, &it );
+            moved.push_back( src_veh->take_item( src_part, &it ) );
         } else {
-            here.i_rem( src, &it );
+            moved.push_back( here.i_take( src, &it ) );
         }
+        put_into_vehicle_or_drop( p, item_drop_reason::deliberate, std::move( moved ), dest );
     }
 
     // If we didn't pick up a whole stack, put the remainder back where it came from.
@@ -1701,8 +1709,9 @@ static bool tidy_activity( player &p, const tripoint &src_loc,
         for( item *inv_elem : p.inv_dump() ) {
             if( inv_elem->has_var( "activity_var" ) ) {
                 inv_elem->erase_var( "activity_var" );
-                put_into_vehicle_or_drop( p, item_drop_reason::deliberate, { *inv_elem }, src_loc );
-                p.i_rem( inv_elem );
+                std::list<item> dropped;
+                dropped.push_back( p.i_rem( inv_elem ) );
+                put_into_vehicle_or_drop( p, item_drop_reason::deliberate, std::move( dropped ), src_loc );
             }
         }
     }
@@ -13,6 +13,7 @@
 #include "color.h"
 #include "damage.h"
 #include "debug.h"
+#include "flag_set.h"
 #include "flat_set.h"
 #include "json.h"
 #include "units.h"
@@ -229,6 +230,11 @@ typename std::enable_if<std::is_constructible<T, std::string>::value, bool>::typ
     return details::assign_set<T, cata::flat_set<T>>( jo, name, val );
 }
 
+inline bool assign( const JsonObject &jo, const std::string &name, flag_set &val, bool = false )
+{
+    return details::assign_set<flag_id, flag_set>( jo, name, val );
+}
+
 inline bool assign( const JsonObject &jo, const std::string &name, units::volume &val,
                     bool strict = false,
                     const units::volume lo = units::volume_min,
@@ -11,6 +11,7 @@ bool tile_iso;
 bool use_tiles;
 bool use_tiles_overmap;
 test_mode_spilling_action_t test_mode_spilling_action = test_mode_spilling_action_t::spill_all;
+bool test_mode_uncompiled_mapgen = false;
 bool direct3d_mode;
 bool pixel_minimap_option;
 error_log_format_t error_log_format = error_log_format_t::human_readable;
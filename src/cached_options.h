@@ -25,6 +25,9 @@ enum class test_mode_spilling_action_t {
     cancel_spill,
 };
 extern test_mode_spilling_action_t test_mode_spilling_action;
+// When set, JSON mapgen places its objects one by one instead of running the instructions
+// they were compiled to, so tests can compare the two.
+extern bool test_mode_uncompiled_mapgen;
 
 extern bool direct3d_mode;
 
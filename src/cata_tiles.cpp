@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <array>
 #include <bitset>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
 #include <fstream>
@@ -45,6 +46,7 @@
 #include "mtype.h"
 #include "npc.h"
 #include "optional.h"
+#include "options.h"
 #include "output.h"
 #include "overlay_ordering.h"
 #include "path_info.h"
@@ -227,6 +229,9 @@ void cata_tiles::on_options_changed()
     settings.scale_to_fit = get_option<bool>( "PIXEL_MINIMAP_SCALE_TO_FIT" );
 
     minimap->set_settings( settings );
+
+    frame_cache_debug = get_option<bool>( "DEBUG_TILES_REDRAW" );
+    frame_cache_valid = false;
 }
 
 const tile_type *tileset::find_tile_type( const std::string &id ) const
@@ -303,6 +308,8 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     tileset_loader loader( *new_tileset_ptr, renderer );
     loader.load( tileset_id, precheck );
     tileset_ptr = std::move( new_tileset_ptr );
+    // A reloaded tileset keeps its id, so the frame key alone cannot tell.
+    frame_cache_valid = false;
 
     set_draw_scale( 16 );
 
@@ -1095,20 +1102,19 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
     }
 #endif
 
-    {
-        //set clipping to prevent drawing over stuff we shouldn't
-        SDL_Rect clipRect = {dest.x, dest.y, width, height};
-        printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
-                      "SDL_RenderSetClipRect failed" );
+    const auto frame_start = std::chrono::steady_clock::now();
 
-        //fill render area with black to prevent artifacts where no new pixels are drawn
-        geometry->rect( renderer, clipRect, SDL_Color() );
-    }
+    //set clipping to prevent drawing over stuff we shouldn't
+    const SDL_Rect clipRect = {dest.x, dest.y, width, height};
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
+                  "SDL_RenderSetClipRect failed" );
+
+    //fill render area with black to prevent artifacts where no new pixels are drawn
+    geometry->rect( renderer, clipRect, SDL_Color() );
 
     point s;
     get_window_tile_counts( width, height, s.x, s.y );
 
-    init_light();
     map &here = get_map();
     const visibility_variables &cache = here.get_visibility_variables_cache();
 
@@ -1121,19 +1127,37 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
     screentile_width = divide_round_up( width, tile_width );
     screentile_height = divide_round_up( height, tile_height );
 
+    avatar &you = get_avatar();
+    const level_cache &ch = here.access_cache( center.z );
+
+    const frame_state state = get_frame_state( dest, center, width, height );
+    const bool cacheable = frame_cache_enabled && !frame_has_transient_content();
+    if( !cacheable ) {
+        frame_cache_valid = false;
+    } else if( reuse_cached_frame( state, ch, clipRect ) ) {
+        if( frame_cache_debug ) {
+            const std::chrono::duration<float, std::milli> frame_ms =
+                std::chrono::steady_clock::now() - frame_start;
+            draw_frame_cache_debug( clipRect, false, frame_ms.count(), overlay_strings );
+        }
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+        return;
+    }
+
+    drew_idle_animation = false;
+    init_light();
+
     const int min_col = 0;
     const int max_col = s.x;
     const int min_row = 0;
     const int max_row = s.y;
 
-    avatar &you = get_avatar();
     //limit the render area to maximum view range (121x121 square centered on player)
     const point min_visible( you.posx() % SEEX, you.posy() % SEEY );
     const point max_visible( ( you.posx() % SEEX ) + ( MAPSIZE - 1 ) * SEEX,
                              ( you.posy() % SEEY ) + ( MAPSIZE - 1 ) * SEEY );
 
-    const level_cache &ch = here.access_cache( center.z );
-
     // Map memory should be at least the size of the view range
     // so that new tiles can be memorized, and at least the size of the display
     // since at farthest zoom displayed area may be bigger than view range.
@@ -1332,9 +1356,10 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                 } else {
                     color = catacurses::blue + bold;
                 }
-                if( get_option<std::string>( "USE_CELSIUS" ) == "celsius" ) {
+                static const option_handle<std::string> use_celsius( "USE_CELSIUS" );
+                if( use_celsius.get() == "celsius" ) {
                     temp_value = temp_to_celsius( temp_value );
-                } else if( get_option<std::string>( "USE_CELSIUS" ) == "kelvin" ) {
+                } else if( use_celsius.get() == "kelvin" ) {
                     temp_value = temp_to_kelvin( temp_value );
 
                 }
@@ -1594,10 +1619,147 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         }
     }
 
+    if( cacheable ) {
+        store_cached_frame( state, ch, clipRect );
+    }
+    if( frame_cache_debug ) {
+        const std::chrono::duration<float, std::milli> frame_ms =
+            std::chrono::steady_clock::now() - frame_start;
+        draw_frame_cache_debug( clipRect, true, frame_ms.count(), overlay_strings );
+    }
+
     printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
                   "SDL_RenderSetClipRect failed" );
 }
 
+cata_tiles::frame_state cata_tiles::get_frame_state( const point &dest, const tripoint &center,
+        const int width, const int height ) const
+{
+    const avatar &you = get_avatar();
+    const map &here = get_map();
+
+    frame_state state;
+    state.dest = dest;
+    state.center = center;
+    state.width = width;
+    state.height = height;
+    state.tile_width = tile_width;
+    state.tile_height = tile_height;
+    state.iso_mode = tile_iso;
+    if( tileset_ptr ) {
+        state.tileset_id = tileset_ptr->get_tileset_id();
+    }
+    state.turn = calendar::turn;
+    state.avatar_pos = you.pos();
+    state.avatar_moves = you.get_moves();
+    state.view_offset = you.view_offset;
+    state.controlling_vehicle = you.controlling_vehicle;
+    state.abs_sub = here.get_abs_sub();
+    state.map_generation = here.get_content_generation();
+    state.num_creatures = g->num_creatures();
+    return state;
+}
+
+bool cata_tiles::frame_state::operator==( const frame_state &rhs ) const
+{
+    return dest == rhs.dest && center == rhs.center && width == rhs.width &&
+           height == rhs.height && tile_width == rhs.tile_width &&
+           tile_height == rhs.tile_height && iso_mode == rhs.iso_mode &&
+           tileset_id == rhs.tileset_id && turn == rhs.turn && avatar_pos == rhs.avatar_pos &&
+           avatar_moves == rhs.avatar_moves && view_offset == rhs.view_offset &&
+           controlling_vehicle == rhs.controlling_vehicle && abs_sub == rhs.abs_sub &&
+           map_generation == rhs.map_generation && num_creatures == rhs.num_creatures;
+}
+
+bool cata_tiles::frame_has_transient_content() const
+{
+    // Animations, debug overlays and the various UI overrides are set up for a
+    // single frame only, or depend on state the frame key does not capture.
+    return do_draw_explosion || do_draw_custom_explosion || do_draw_bullet || do_draw_hit ||
+           do_draw_line || do_draw_cursor || do_draw_highlight || do_draw_weather ||
+           do_draw_sct || do_draw_zones || g->display_any_overlay() ||
+           g->is_zones_manager_open() ||
+           !radiation_override.empty() || !terrain_override.empty() ||
+           !furniture_override.empty() || !graffiti_override.empty() ||
+           !trap_override.empty() || !field_override.empty() || !item_override.empty() ||
+           !vpart_override.empty() || !draw_below_override.empty() ||
+           !monster_override.empty();
+}
+
+bool cata_tiles::reuse_cached_frame( const frame_state &state, const level_cache &ch,
+                                     const SDL_Rect &clip_rect )
+{
+    if( !frame_cache_valid || !frame_cache_tex || state != frame_cache_state ) {
+        return false;
+    }
+    const lit_level *visibility = &ch.visibility_cache[0][0];
+    if( !std::equal( frame_cache_visibility.begin(), frame_cache_visibility.end(), visibility ) ) {
+        return false;
+    }
+    RenderCopy( renderer, frame_cache_tex, nullptr, &clip_rect );
+    frames_reused++;
+    return true;
+}
+
+void cata_tiles::store_cached_frame( const frame_state &state, const level_cache &ch,
+                                     const SDL_Rect &clip_rect )
+{
+    frames_redrawn++;
+    if( drew_idle_animation ) {
+        // Idle animations advance with the system clock, the next frame will differ.
+        frame_cache_valid = false;
+        return;
+    }
+    int tex_width = 0;
+    int tex_height = 0;
+    if( frame_cache_tex ) {
+        SDL_QueryTexture( frame_cache_tex.get(), nullptr, nullptr, &tex_width, &tex_height );
+    }
+    if( !frame_cache_tex || tex_width != clip_rect.w || tex_height != clip_rect.h ) {
+        frame_cache_tex = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888,
+                                         SDL_TEXTUREACCESS_TARGET, clip_rect.w, clip_rect.h );
+        if( !frame_cache_tex ) {
+            // Renderer without render target support, always redraw.
+            frame_cache_enabled = false;
+            frame_cache_valid = false;
+            return;
+        }
+    }
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+                  "SDL_RenderSetClipRect failed" );
+    SetRenderTarget( renderer, frame_cache_tex );
+    RenderCopy( renderer, get_displaybuffer(), &clip_rect, nullptr );
+    set_displaybuffer_rendertarget();
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clip_rect ) != 0,
+                  "SDL_RenderSetClipRect failed" );
+
+    const lit_level *visibility = &ch.visibility_cache[0][0];
+    frame_cache_visibility.assign( visibility, visibility + MAPSIZE_X * MAPSIZE_Y );
+    frame_cache_state = state;
+    frame_cache_valid = true;
+}
+
+void cata_tiles::draw_frame_cache_debug( const SDL_Rect &clip_rect, const bool redrawn,
+        const float frame_ms, std::multimap<point, formatted_text> &overlay_strings )
+{
+    if( redrawn ) {
+        // Outline the redrawn region
+        const SDL_Color outline = { 255, 0, 0, 255 };
+        const point top_left( clip_rect.x, clip_rect.y );
+        const point bottom_left( clip_rect.x, clip_rect.y + clip_rect.h - 2 );
+        const point top_right( clip_rect.x + clip_rect.w - 2, clip_rect.y );
+        geometry->horizontal_line( renderer, top_left, clip_rect.x + clip_rect.w, 2, outline );
+        geometry->horizontal_line( renderer, bottom_left, clip_rect.x + clip_rect.w, 2, outline );
+        geometry->vertical_line( renderer, top_left, clip_rect.y + clip_rect.h, 2, outline );
+        geometry->vertical_line( renderer, top_right, clip_rect.y + clip_rect.h, 2, outline );
+    }
+    overlay_strings.emplace( point( clip_rect.x + tile_width / 2, clip_rect.y + tile_height / 2 ),
+                             formatted_text( string_format( "%s %.2f ms (redrawn %d, reused %d)",
+                                     redrawn ? "redraw" : "reuse", frame_ms, frames_redrawn,
+                                     frames_reused ), redrawn ? catacurses::red : catacurses::green,
+                                     text_alignment::left ) );
+}
+
 void cata_tiles::draw_minimap( const point &dest, const tripoint &center, int width, int height )
 {
     minimap->draw( SDL_Rect{ dest.x, dest.y, width, height }, center );
@@ -2127,6 +2289,7 @@ bool cata_tiles::draw_from_id_string( const std::string &id, TILE_CATEGORY categ
 
         // idle tile animations:
         if( display_tile.animated ) {
+            drew_idle_animation = true;
             // idle animations run during the user's turn, and the animation speed
             // needs to be defined by the tileset to look good, so we use system clock:
             auto now = std::chrono::system_clock::now();
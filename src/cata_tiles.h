@@ -3,6 +3,7 @@
 #define CATA_SRC_CATA_TILES_H
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -12,6 +13,7 @@
 #include <vector>
 
 #include "animation.h"
+#include "calendar.h"
 #include "creature.h"
 #include "enums.h"
 #include "lightmap.h"
@@ -28,9 +30,11 @@
 
 class Character;
 class JsonObject;
+struct level_cache;
 class pixel_minimap;
 
 extern void set_displaybuffer_rendertarget();
+extern const SDL_Texture_Ptr &get_displaybuffer();
 
 /** Structures */
 struct tile_type {
@@ -639,6 +643,63 @@ class cata_tiles
          */
         bool nv_goggles_activated = false;
 
+    public:
+        /**
+         * Everything the terrain view depends on besides lighting, which is compared
+         * separately. Changes to the map that cost no moves, like debug or menu actions,
+         * are caught by the map's content generation and the number of creatures.
+         */
+        struct frame_state {
+            point dest;
+            tripoint center;
+            int width = 0;
+            int height = 0;
+            int tile_width = 0;
+            int tile_height = 0;
+            bool iso_mode = false;
+            // The id rather than the address, a new tileset may be allocated at the same address
+            std::string tileset_id;
+            time_point turn;
+            tripoint avatar_pos;
+            int avatar_moves = 0;
+            tripoint view_offset;
+            bool controlling_vehicle = false;
+            tripoint abs_sub;
+            uint64_t map_generation = 0;
+            size_t num_creatures = 0;
+
+            bool operator==( const frame_state &rhs ) const;
+            bool operator!=( const frame_state &rhs ) const {
+                return !( *this == rhs );
+            }
+        };
+        /** The state a terrain view drawn by @ref draw with these arguments would depend on */
+        frame_state get_frame_state( const point &dest, const tripoint &center, int width,
+                                     int height ) const;
+
+    private:
+        /** Returns true if this frame draws something that is not captured by @ref frame_state */
+        bool frame_has_transient_content() const;
+        /** Copies the previously rendered terrain view back to the display, if still valid */
+        bool reuse_cached_frame( const frame_state &state, const level_cache &ch,
+                                 const SDL_Rect &clip_rect );
+        void store_cached_frame( const frame_state &state, const level_cache &ch,
+                                 const SDL_Rect &clip_rect );
+        void draw_frame_cache_debug( const SDL_Rect &clip_rect, bool redrawn, float frame_ms,
+                                     std::multimap<point, formatted_text> &overlay_strings );
+
+        // Copy of the last rendered terrain view
+        SDL_Texture_Ptr frame_cache_tex;
+        frame_state frame_cache_state;
+        std::vector<lit_level> frame_cache_visibility;
+        bool frame_cache_valid = false;
+        bool frame_cache_enabled = true;
+        bool frame_cache_debug = false;
+        // Set when a tile with an idle animation was drawn in the current frame
+        bool drew_idle_animation = false;
+        int frames_redrawn = 0;
+        int frames_reused = 0;
+
         pimpl<pixel_minimap> minimap;
 
     public:
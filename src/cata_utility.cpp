@@ -99,6 +99,20 @@ bool lcmatch( const translation &str, const std::string &qry )
     return lcmatch( str.translated(), qry );
 }
 
+std::string lcmatch_lower( const std::string &str )
+{
+    if( std::locale().name() != "en_US.UTF-8" && std::locale().name() != "C" ) {
+        const auto &f = std::use_facet<std::ctype<wchar_t>>( std::locale() );
+        std::wstring wstr = utf8_to_wstr( str );
+        f.tolower( &wstr[0], &wstr[0] + wstr.size() );
+        return wstr_to_utf8( wstr );
+    }
+    std::string res;
+    res.reserve( str.size() );
+    std::transform( str.begin(), str.end(), std::back_inserter( res ), tolower );
+    return res;
+}
+
 bool match_include_exclude( const std::string &text, std::string filter )
 {
     size_t iPos;
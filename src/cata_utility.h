@@ -102,6 +102,14 @@ bool isBetween( int test, int down, int up );
 bool lcmatch( const std::string &str, const std::string &qry );
 bool lcmatch( const translation &str, const std::string &qry );
 
+/**
+ * Converts a string to lower case the same way @ref lcmatch does.
+ *
+ * Searching for the converted query in the converted subject gives the same result
+ * as @ref lcmatch, which allows converting the subject once for repeated searches.
+ */
+std::string lcmatch_lower( const std::string &str );
+
 /**
  * Matches text case insensitive with the include/exclude rules of the filter
  *
@@ -4452,6 +4452,8 @@ void Character::calc_encumbrance( const item &new_item )
     std::map<bodypart_id, encumbrance_data> enc;
     item_encumb( enc, new_item );
     mut_cbm_encumb( enc );
+    // Whatever changed the encumbrance may have changed the warmth of the clothing too
+    clothing_cache_valid = false;
 
     for( const std::pair<const bodypart_id, encumbrance_data> &elem : enc ) {
         set_part_encumbrance_data( elem.first, elem.second );
@@ -4654,39 +4656,105 @@ bool Character::in_climate_control()
 
 int Character::get_wind_resistance( const bodypart_id &bp ) const
 {
-    int coverage = 0;
-    float totalExposed = 1.0f;
-    int totalCoverage = 0;
-    int penalty = 100;
+    // Your shell provides complete wind protection if you're inside it
+    if( has_active_mutation( trait_SHELL2 ) ) {
+        return 100;
+    }
 
-    for( const item &i : worn ) {
-        if( i.covers( bp ) ) {
-            if( i.made_of( material_id( "leather" ) ) || i.made_of( material_id( "plastic" ) ) ||
-                i.made_of( material_id( "bone" ) ) ||
-                i.made_of( material_id( "chitin" ) ) || i.made_of( material_id( "nomex" ) ) ) {
-                penalty = 10; // 90% effective
-            } else if( i.made_of( material_id( "cotton" ) ) ) {
-                penalty = 30;
-            } else if( i.made_of( material_id( "wool" ) ) ) {
-                penalty = 40;
-            } else {
-                penalty = 1; // 99% effective
-            }
+    return static_cast<int>( 100 - get_clothing_warmth( bp ).wind_exposure * 100 );
+}
 
-            coverage = std::max( 0, i.get_coverage( bp ) - penalty );
-            totalExposed *= ( 1.0 - coverage / 100.0 ); // Coverage is between 0 and 1?
+static int bestwarmth( const std::list< item > &its, const flag_id &flag )
+{
+    int best = 0;
+    for( const item &w : its ) {
+        if( w.has_flag( flag ) && w.get_warmth() > best ) {
+            best = w.get_warmth();
         }
     }
+    return best;
+}
 
-    // Your shell provides complete wind protection if you're inside it
-    if( has_active_mutation( trait_SHELL2 ) ) {
-        totalCoverage = 100;
-        return totalCoverage;
+Character::clothing_cache_entry::clothing_cache_entry( const item &it ) :
+    worn_item( &it ), type( it.type ), warmth( it.get_warmth() ), worn_side( it.get_side() ),
+    pockets( it.has_flag( flag_POCKETS ) ), hood( it.has_flag( flag_HOOD ) ),
+    collar( it.has_flag( flag_COLLAR ) )
+{
+}
+
+bool Character::clothing_cache_entry::operator==( const clothing_cache_entry &rhs ) const
+{
+    return worn_item == rhs.worn_item && type == rhs.type && warmth == rhs.warmth &&
+           worn_side == rhs.worn_side && pockets == rhs.pockets && hood == rhs.hood &&
+           collar == rhs.collar;
+}
+
+const Character::clothing_warmth_data &Character::get_clothing_warmth(
+    const bodypart_id &bp ) const
+{
+    // Worn items are also added, removed and modified without going through wear/takeoff,
+    // so make sure they are still the ones the cache was built from.
+    if( clothing_cache_valid && clothing_cache_items.size() == worn.size() ) {
+        auto cached = clothing_cache_items.begin();
+        for( const item &it : worn ) {
+            if( !( *cached == clothing_cache_entry( it ) ) ) {
+                clothing_cache_valid = false;
+                break;
+            }
+            ++cached;
+        }
+    } else {
+        clothing_cache_valid = false;
+    }
+    if( !clothing_cache_valid ) {
+        clothing_warmth_cache.clear();
+        clothing_cache_items.clear();
+        for( const item &it : worn ) {
+            clothing_cache_items.emplace_back( it );
+        }
+        clothing_cache_valid = true;
     }
 
-    totalCoverage = 100 - totalExposed * 100;
+    auto found = clothing_warmth_cache.find( bp );
+    if( found != clothing_warmth_cache.end() ) {
+        return found->second;
+    }
+    clothing_warmth_data &data = clothing_warmth_cache[bp];
+    if( bp == body_part_hand_l || bp == body_part_hand_r ) {
+        data.bonus_warmth = bestwarmth( worn, flag_POCKETS );
+    } else if( bp == body_part_head ) {
+        data.bonus_warmth = bestwarmth( worn, flag_HOOD );
+    } else if( bp == body_part_mouth ) {
+        data.bonus_warmth = bestwarmth( worn, flag_COLLAR );
+    }
+    for( const item &i : worn ) {
+        if( !i.covers( bp ) ) {
+            continue;
+        }
+        // Wool items do not lose their warmth due to being wet.
+        if( i.made_of( material_id( "wool" ) ) ) {
+            data.wet_proof_warmth += i.get_warmth();
+        } else {
+            data.wettable_warmth.push_back( i.get_warmth() );
+        }
+
+        int penalty = 100;
+        if( i.made_of( material_id( "leather" ) ) || i.made_of( material_id( "plastic" ) ) ||
+            i.made_of( material_id( "bone" ) ) ||
+            i.made_of( material_id( "chitin" ) ) || i.made_of( material_id( "nomex" ) ) ) {
+            penalty = 10; // 90% effective
+        } else if( i.made_of( material_id( "cotton" ) ) ) {
+            penalty = 30;
+        } else if( i.made_of( material_id( "wool" ) ) ) {
+            penalty = 40;
+        } else {
+            penalty = 1; // 99% effective
+        }
 
-    return totalCoverage;
+        const int coverage = std::max( 0, i.get_coverage( bp ) - penalty );
+        data.wind_exposure *= ( 1.0 - coverage / 100.0 ); // Coverage is between 0 and 1?
+    }
+    return data;
 }
 
 void layer_details::reset()
@@ -4927,11 +4995,11 @@ int Character::get_int_bonus() const
 
 static int get_speedydex_bonus( const int dex )
 {
-    static const std::string speedydex_min_dex( "SPEEDYDEX_MIN_DEX" );
-    static const std::string speedydex_dex_speed( "SPEEDYDEX_DEX_SPEED" );
+    static const option_handle<int> speedydex_min_dex( "SPEEDYDEX_MIN_DEX" );
+    static const option_handle<int> speedydex_dex_speed( "SPEEDYDEX_DEX_SPEED" );
     // this is the number to be multiplied by the increment
-    const int modified_dex = std::max( dex - get_option<int>( speedydex_min_dex ), 0 );
-    return modified_dex * get_option<int>( speedydex_dex_speed );
+    const int modified_dex = std::max( dex - speedydex_min_dex.get(), 0 );
+    return modified_dex * speedydex_dex_speed.get();
 }
 
 int Character::get_speed() const
@@ -5674,8 +5742,9 @@ int Character::weariness() const
 
 int Character::weary_threshold() const
 {
+    static const option_handle<float> weary_bmr_mult( "WEARY_BMR_MULT" );
     const int bmr = base_bmr();
-    int threshold = bmr * get_option<float>( "WEARY_BMR_MULT" );
+    int threshold = bmr * weary_bmr_mult.get();
     // reduce by 1% per 14 points of fatigue after 150 points
     threshold *= 1.0f - ( ( std::max( fatigue, -20 ) - 150 ) / 1400.0f );
     // Each 2 points of morale increase or decrease by 1%
@@ -5689,13 +5758,15 @@ int Character::weary_threshold() const
 std::pair<int, int> Character::weariness_transition_progress() const
 {
     // Mostly a duplicate of the below function. No real way to clean this up
+    static const option_handle<float> weary_initial_step( "WEARY_INITIAL_STEP" );
+    static const option_handle<float> weary_thresh_scaling( "WEARY_THRESH_SCALING" );
     int amount = weariness();
     int threshold = weary_threshold();
-    amount -= threshold * get_option<float>( "WEARY_INITIAL_STEP" );
+    amount -= threshold * weary_initial_step.get();
     while( amount >= 0 ) {
         amount -= threshold;
         if( threshold > 20 ) {
-            threshold *= get_option<float>( "WEARY_THRESH_SCALING" );
+            threshold *= weary_thresh_scaling.get();
         }
     }
 
@@ -5706,14 +5777,16 @@ std::pair<int, int> Character::weariness_transition_progress() const
 
 int Character::weariness_level() const
 {
+    static const option_handle<float> weary_initial_step( "WEARY_INITIAL_STEP" );
+    static const option_handle<float> weary_thresh_scaling( "WEARY_THRESH_SCALING" );
     int amount = weariness();
     int threshold = weary_threshold();
     int level = 0;
-    amount -= threshold * get_option<float>( "WEARY_INITIAL_STEP" );
+    amount -= threshold * weary_initial_step.get();
     while( amount >= 0 ) {
         amount -= threshold;
         if( threshold > 20 ) {
-            threshold *= get_option<float>( "WEARY_THRESH_SCALING" );
+            threshold *= weary_thresh_scaling.get();
         }
         ++level;
     }
@@ -5769,7 +5842,6 @@ float Character::activity_level() const
 
 void Character::update_stomach( const time_point &from, const time_point &to )
 {
-    const needs_rates rates = calc_needs_rates();
     // No food/thirst/fatigue clock at all
     const bool debug_ls = has_trait( trait_DEBUG_LS );
     // No food/thirst, capped fatigue clock (only up to tired)
@@ -5777,12 +5849,14 @@ void Character::update_stomach( const time_point &from, const time_point &to )
     const bool foodless = debug_ls || npc_no_food;
     const bool no_thirst = has_flag( json_flag_NO_THIRST );
     const bool mycus = has_trait( trait_M_DEPENDENT );
-    const float kcal_per_time = get_bmr() / ( 12.0f * 24.0f );
     const int five_mins = ticks_between( from, to, 5_minutes );
     const int half_hours = ticks_between( from, to, 30_minutes );
     const units::volume stomach_capacity = stomach.capacity( *this );
 
     if( five_mins > 0 ) {
+        // Needs only advance on 5 minute ticks, so the rates are not worth computing on other turns
+        const needs_rates rates = calc_needs_rates();
+        const float kcal_per_time = get_bmr() / ( 12.0f * 24.0f );
         // Digest nutrients in stomach, they are destined for the guts (except water)
         food_summary digested_to_guts = stomach.digest( *this, rates, five_mins, half_hours );
         // Digest nutrients in guts, they will be distributed to needs levels
@@ -5801,6 +5875,9 @@ void Character::update_stomach( const time_point &from, const time_point &to )
             // Explicitly floor it here, the int cast will do so anyways
             mod_stored_calories( -std::floor( five_mins * kcal_per_time * 1000 ) );
         }
+        if( !foodless && rates.thirst > 0.0f ) {
+            mod_thirst( roll_remainder( rates.thirst * five_mins ) );
+        }
     }
     // if npc_no_food no need to calc hunger, and set hunger_effect
     if( npc_no_food ) {
@@ -5847,9 +5924,6 @@ void Character::update_stomach( const time_point &from, const time_point &to )
         }
     }
 
-    if( !foodless && rates.thirst > 0.0f ) {
-        mod_thirst( roll_remainder( rates.thirst * five_mins ) );
-    }
     // Mycus and Metabolic Rehydration makes thirst unnecessary
     // since water is not limited by intake but by absorption, we can just set thirst to zero
     if( mycus || no_thirst ) {
@@ -6062,16 +6136,16 @@ needs_rates Character::calc_needs_rates() const
 
     add_msg_debug_if_player( debugmode::DF_CHAR_CALORIES, "Metabolic rate: %.2f", rates.hunger );
 
-    static const std::string player_thirst_rate( "PLAYER_THIRST_RATE" );
-    rates.thirst = get_option< float >( player_thirst_rate );
+    static const option_handle<float> player_thirst_rate( "PLAYER_THIRST_RATE" );
+    rates.thirst = player_thirst_rate.get();
     static const std::string thirst_modifier( "thirst_modifier" );
     rates.thirst *= 1.0f + mutation_value( thirst_modifier );
     if( worn_with_flag( flag_SLOWS_THIRST ) ) {
         rates.thirst *= 0.7f;
     }
 
-    static const std::string player_fatigue_rate( "PLAYER_FATIGUE_RATE" );
-    rates.fatigue = get_option< float >( player_fatigue_rate );
+    static const option_handle<float> player_fatigue_rate( "PLAYER_FATIGUE_RATE" );
+    rates.fatigue = player_fatigue_rate.get();
     static const std::string fatigue_modifier( "fatigue_modifier" );
     rates.fatigue *= 1.0f + mutation_value( fatigue_modifier );
 
@@ -8128,12 +8202,14 @@ float Character::mutation_value( const std::string &val ) const
 
 float Character::healing_rate( float at_rest_quality ) const
 {
+    static const option_handle<float> player_healing_rate( "PLAYER_HEALING_RATE" );
+    static const option_handle<float> npc_healing_rate( "NPC_HEALING_RATE" );
     // TODO: Cache
     float heal_rate;
     if( !is_npc() ) {
-        heal_rate = get_option< float >( "PLAYER_HEALING_RATE" );
+        heal_rate = player_healing_rate.get();
     } else {
-        heal_rate = get_option< float >( "NPC_HEALING_RATE" );
+        heal_rate = npc_healing_rate.get();
     }
     float awake_rate = heal_rate * mutation_value( "healing_awake" );
     float final_rate = 0.0f;
@@ -8625,9 +8701,9 @@ int Character::get_stamina() const
 
 int Character::get_stamina_max() const
 {
-    static const std::string player_max_stamina( "PLAYER_MAX_STAMINA" );
+    static const option_handle<int> player_max_stamina( "PLAYER_MAX_STAMINA" );
     static const std::string max_stamina_modifier( "max_stamina_modifier" );
-    int maxStamina = get_option< int >( player_max_stamina );
+    int maxStamina = player_max_stamina.get();
     maxStamina *= Character::mutation_value( max_stamina_modifier );
     maxStamina = enchantment_cache->modify_value( enchant_vals::mod::MAX_STAMINA, maxStamina );
     return maxStamina;
@@ -8661,7 +8737,9 @@ void Character::burn_move_stamina( int moves )
         overburden_percentage = ( current_weight - max_weight ) * 100 / max_weight;
     }
 
-    int burn_ratio = get_option<int>( "PLAYER_BASE_STAMINA_BURN_RATE" );
+    static const option_handle<int> player_base_stamina_burn_rate(
+        "PLAYER_BASE_STAMINA_BURN_RATE" );
+    int burn_ratio = player_base_stamina_burn_rate.get();
     for( const bionic_id &bid : get_bionic_fueled_with( item( "muscle" ) ) ) {
         if( has_active_bionic( bid ) ) {
             burn_ratio = burn_ratio * 2 - 3;
@@ -8693,9 +8771,10 @@ float Character::stamina_move_cost_modifier() const
 
 void Character::update_stamina( int turns )
 {
-    static const std::string player_base_stamina_regen_rate( "PLAYER_BASE_STAMINA_REGEN_RATE" );
+    static const option_handle<float> player_base_stamina_regen_rate(
+        "PLAYER_BASE_STAMINA_REGEN_RATE" );
     static const std::string stamina_regen_modifier( "stamina_regen_modifier" );
-    const float base_regen_rate = get_option<float>( player_base_stamina_regen_rate );
+    const float base_regen_rate = player_base_stamina_regen_rate.get();
     const int current_stim = get_stim();
     float stamina_recovery = 0.0f;
     // Recover some stamina every turn.
@@ -11058,35 +11137,17 @@ std::string Character::is_snuggling() const
 
 int Character::warmth( const bodypart_id &bp ) const
 {
-    int ret = 0;
-    double warmth = 0.0;
-
-    for( const item &i : worn ) {
-        if( i.covers( bp ) ) {
-            warmth = i.get_warmth();
-            // Wool items do not lose their warmth due to being wet.
-            // Warmth is reduced by 0 - 66% based on wetness.
-            if( !i.made_of( material_id( "wool" ) ) ) {
-                warmth *= 1.0 - 0.66 * get_part_wetness_percentage( bp );
-            }
-            ret += std::round( warmth );
-        }
+    const clothing_warmth_data &clothing = get_clothing_warmth( bp );
+    int ret = clothing.wet_proof_warmth;
+    // Warmth is reduced by 0 - 66% based on wetness.
+    const double wet_factor = 1.0 - 0.66 * get_part_wetness_percentage( bp );
+    for( const int warmth : clothing.wettable_warmth ) {
+        ret += std::round( warmth * wet_factor );
     }
     ret += get_effect_int( effect_heating_bionic, bp );
     return ret;
 }
 
-static int bestwarmth( const std::list< item > &its, const flag_id &flag )
-{
-    int best = 0;
-    for( const item &w : its ) {
-        if( w.has_flag( flag ) && w.get_warmth() > best ) {
-            best = w.get_warmth();
-        }
-    }
-    return best;
-}
-
 int Character::bonus_item_warmth( const bodypart_id &bp ) const
 {
     int ret = 0;
@@ -11094,17 +11155,17 @@ int Character::bonus_item_warmth( const bodypart_id &bp ) const
     // If the player is not wielding anything big, check if hands can be put in pockets
     if( ( bp == body_part_hand_l || bp == body_part_hand_r ) &&
         weapon.volume() < 500_ml ) {
-        ret += bestwarmth( worn, flag_POCKETS );
+        ret += get_clothing_warmth( bp ).bonus_warmth;
     }
 
     // If the player's head is not encumbered, check if hood can be put up
     if( bp == body_part_head && encumb( body_part_head ) < 10 ) {
-        ret += bestwarmth( worn, flag_HOOD );
+        ret += get_clothing_warmth( bp ).bonus_warmth;
     }
 
     // If the player's mouth is not encumbered, check if collar can be put up
     if( bp == body_part_mouth && encumb( body_part_mouth ) < 10 ) {
-        ret += bestwarmth( worn, flag_COLLAR );
+        ret += get_clothing_warmth( bp ).bonus_warmth;
     }
 
     return ret;
@@ -79,6 +79,7 @@ class player_morale;
 class proficiency_set;
 class recipe_subset;
 class spell;
+class temp_crafting_inventory;
 class vpart_reference;
 struct bionic;
 struct construction;
@@ -2482,6 +2483,16 @@ class Character : public Creature, public visitable
         * */
         const inventory &crafting_inventory( const tripoint &src_pos = tripoint_zero,
                                              int radius = PICKUP_RANGE, bool clear_path = true ) const;
+        /**
+        * Non-owning counterpart of @ref crafting_inventory. Items on the map, in vehicles and
+        * carried by the character are referenced instead of copied, only pseudo items are owned
+        * by @p view. The references are valid as long as no item is moved or destroyed, e.g.
+        * for the duration of a menu.
+        * Parameters are the same as for @ref crafting_inventory.
+        * */
+        void form_crafting_inventory( temp_crafting_inventory &view,
+                                      const tripoint &src_pos = tripoint_zero,
+                                      int radius = PICKUP_RANGE, bool clear_path = true ) const;
         void invalidate_crafting_inventory();
 
         /** Returns a value from 1.0 to 11.0 that acts as a multiplier
@@ -2503,7 +2514,7 @@ class Character : public Creature, public visitable
         // Checks crafting inventory for books providing the requested recipe.
         // Then checks nearby NPCs who could provide it too.
         // Returns -1 to indicate recipe not found, otherwise difficulty to learn.
-        int has_recipe( const recipe *r, const inventory &crafting_inv,
+        int has_recipe( const recipe *r, const read_only_visitable &crafting_inv,
                         const std::vector<npc *> &helpers ) const;
         bool knows_recipe( const recipe *rec ) const;
         void learn_recipe( const recipe *rec );
@@ -2516,13 +2527,13 @@ class Character : public Creature, public visitable
         /** Returns all known recipes. */
         const recipe_subset &get_learned_recipes() const;
         /** Returns all recipes that are known from the books (either in inventory or nearby). */
-        recipe_subset get_recipes_from_books( const inventory &crafting_inv ) const;
+        recipe_subset get_recipes_from_books( const read_only_visitable &crafting_inv ) const;
         /**
           * Returns all available recipes (from books and npc companions)
           * @param crafting_inv Current available items to craft
           * @param helpers List of NPCs that could help with crafting.
           */
-        recipe_subset get_available_recipes( const inventory &crafting_inv,
+        recipe_subset get_available_recipes( const read_only_visitable &crafting_inv,
                                              const std::vector<npc *> *helpers = nullptr ) const;
         /**
           * Returns the set of book types in crafting_inv that provide the
@@ -2530,7 +2541,7 @@ class Character : public Creature, public visitable
           * @param crafting_inv Current available items that may contain readable books
           * @param r Recipe to search for in the available books
           */
-        std::set<itype_id> get_books_for_recipe( const inventory &crafting_inv,
+        std::set<itype_id> get_books_for_recipe( const read_only_visitable &crafting_inv,
                 const recipe *r ) const;
 
         // crafting.cpp
@@ -2827,6 +2838,40 @@ class Character : public Creature, public visitable
          */
         mutable cata::optional<units::mass> cached_weight_carried = cata::nullopt;
 
+        /** Values derived from the worn clothing, for the body temperature of one body part. */
+        struct clothing_warmth_data {
+            // Warmth of the covering items that lose warmth when wet
+            std::vector<int> wettable_warmth;
+            // Warmth of the covering items that keep it when wet
+            int wet_proof_warmth = 0;
+            // Fraction of the body part exposed to wind
+            float wind_exposure = 1.0f;
+            // Best warmth of the pockets, hood or collar that can cover the body part
+            int bonus_warmth = 0;
+        };
+        /** What a worn item contributes to @ref clothing_warmth_cache. */
+        struct clothing_cache_entry {
+            explicit clothing_cache_entry( const item &it );
+            const item *worn_item;
+            const itype *type;
+            // Includes the warmth of clothing mods
+            int warmth;
+            side worn_side;
+            bool pockets;
+            bool hood;
+            bool collar;
+            bool operator==( const clothing_cache_entry &rhs ) const;
+        };
+        /**
+         * Clothing values per body part, rebuilt when the worn items differ from
+         * @ref clothing_cache_items or encumbrance is recalculated. Items modified in place
+         * (clothing mods, flags, side) differ too.
+         */
+        mutable std::map<bodypart_id, clothing_warmth_data> clothing_warmth_cache;
+        mutable std::vector<clothing_cache_entry> clothing_cache_items;
+        mutable bool clothing_cache_valid = false;
+        const clothing_warmth_data &get_clothing_warmth( const bodypart_id &bp ) const;
+
         void store( JsonOut &json ) const;
         void load( const JsonObject &data );
 
@@ -17,8 +17,9 @@
 #include "skill.h"
 #include "type_id.h"
 #include "value_ptr.h"
+#include "visitable.h"
 
-int Character::has_recipe( const recipe *r, const inventory &crafting_inv,
+int Character::has_recipe( const recipe *r, const read_only_visitable &crafting_inv,
                            const std::vector<npc *> &helpers ) const
 {
     if( !r->skill_used ) {
@@ -89,23 +90,22 @@ const recipe_subset &Character::get_learned_recipes() const
     return *learned_recipes;
 }
 
-recipe_subset Character::get_recipes_from_books( const inventory &crafting_inv ) const
+recipe_subset Character::get_recipes_from_books( const read_only_visitable &crafting_inv ) const
 {
     recipe_subset res;
 
-    for( const auto &stack : crafting_inv.const_slice() ) {
-        const item &candidate = stack->front();
-
+    crafting_inv.visit_items( [&]( const item * candidate, const item * ) {
         for( std::pair<const recipe *, int> recipe_entry :
-             candidate.get_available_recipes( *this ) ) {
+             candidate->get_available_recipes( *this ) ) {
             res.include( recipe_entry.first, recipe_entry.second );
         }
-    }
+        return VisitResponse::SKIP;
+    } );
 
     return res;
 }
 
-recipe_subset Character::get_available_recipes( const inventory &crafting_inv,
+recipe_subset Character::get_available_recipes( const read_only_visitable &crafting_inv,
         const std::vector<npc *> *helpers ) const
 {
     recipe_subset res( get_learned_recipes() );
@@ -127,7 +127,7 @@ recipe_subset Character::get_available_recipes( const inventory &crafting_inv,
     return res;
 }
 
-std::set<itype_id> Character::get_books_for_recipe( const inventory &crafting_inv,
+std::set<itype_id> Character::get_books_for_recipe( const read_only_visitable &crafting_inv,
         const recipe *r ) const
 {
     std::set<itype_id> book_ids;
@@ -0,0 +1,196 @@
+#pragma once
+#ifndef CATA_SRC_CLOCK_CACHE_H
+#define CATA_SRC_CLOCK_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * Cache with a fixed number of entries.
+ *
+ * Entries live in a single open-addressed table (linear probing), so neither lookups nor
+ * insertions allocate once the table exists. When the cache is full, an entry that was not
+ * used since the clock hand last passed it is evicted (CLOCK, an approximation of LRU).
+ * The table is only allocated on the first insertion, and @ref clear does not touch it.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class clock_cache
+{
+    public:
+        struct statistics {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evictions = 0;
+
+            double hit_rate() const {
+                const uint64_t lookups = hits + misses;
+                return lookups == 0 ? 0.0 : static_cast<double>( hits ) / lookups;
+            }
+        };
+
+        /** @param limit Maximal number of entries kept in the cache */
+        explicit clock_cache( size_t limit ) : limit( limit > 0 ? limit : 1 ) {
+            // keep the load factor at or below 3/4 so probe sequences stay short
+            size_t buckets = 8;
+            while( buckets * 3 < this->limit * 4 ) {
+                buckets *= 2;
+            }
+            mask = buckets - 1;
+            while( buckets > 1 ) {
+                buckets /= 2;
+                ++shift_bits;
+            }
+        }
+
+        /** Value stored for the key, or `default_` if there is none */
+        Value get( const Key &key, const Value &default_ ) const {
+            const slot *found = find( key );
+            if( found == nullptr ) {
+                ++counters.misses;
+                return default_;
+            }
+            ++counters.hits;
+            found->referenced = true;
+            return found->value;
+        }
+
+        void insert( const Key &key, const Value &value ) {
+            if( slots.empty() ) {
+                slots.resize( mask + 1 );
+            }
+            if( slot *found = find( key ) ) {
+                found->value = value;
+                found->referenced = true;
+                return;
+            }
+            if( entries >= limit ) {
+                evict();
+            }
+            size_t i = home( key );
+            while( is_used( slots[i] ) ) {
+                i = ( i + 1 ) & mask;
+            }
+            slot &s = slots[i];
+            s.key = key;
+            s.value = value;
+            s.generation = generation;
+            s.referenced = false;
+            ++entries;
+        }
+
+        void remove( const Key &key ) {
+            if( const slot *found = find( key ) ) {
+                erase_at( static_cast<size_t>( found - slots.data() ) );
+            }
+        }
+
+        /** Drops all entries in constant time, the statistics are kept */
+        void clear() {
+            entries = 0;
+            hand = 0;
+            if( ++generation == 0 ) {
+                // the generation wrapped around, old slots could look used again
+                slots.assign( slots.size(), slot() );
+                generation = 1;
+            }
+        }
+
+        size_t size() const {
+            return entries;
+        }
+        size_t capacity() const {
+            return limit;
+        }
+
+        const statistics &stats() const {
+            return counters;
+        }
+        void reset_stats() {
+            counters = statistics();
+        }
+
+    private:
+        struct slot {
+            Key key = Key();
+            Value value = Value();
+            /** The slot is used if this matches the generation of the cache */
+            uint32_t generation = 0;
+            mutable bool referenced = false;
+        };
+
+        bool is_used( const slot &s ) const {
+            return s.generation == generation;
+        }
+
+        size_t home( const Key &key ) const {
+            // Fibonacci hashing, spreads hashes whose low bits are poorly distributed
+            const uint64_t h = static_cast<uint64_t>( Hash()( key ) ) * UINT64_C( 0x9E3779B97F4A7C15 );
+            return static_cast<size_t>( h >> ( 64 - shift_bits ) ) & mask;
+        }
+
+        slot *find( const Key &key ) {
+            return const_cast<slot *>( static_cast<const clock_cache *>( this )->find( key ) );
+        }
+        const slot *find( const Key &key ) const {
+            if( entries == 0 ) {
+                return nullptr;
+            }
+            for( size_t i = home( key ); is_used( slots[i] ); i = ( i + 1 ) & mask ) {
+                if( slots[i].key == key ) {
+                    return &slots[i];
+                }
+            }
+            return nullptr;
+        }
+
+        /** Removes the first entry not referenced since the hand last passed it */
+        void evict() {
+            while( true ) {
+                slot &s = slots[hand];
+                if( is_used( s ) ) {
+                    if( !s.referenced ) {
+                        // erasing moves a later entry into this slot, so the hand stays here
+                        erase_at( hand );
+                        ++counters.evictions;
+                        return;
+                    }
+                    s.referenced = false;
+                }
+                hand = ( hand + 1 ) & mask;
+            }
+        }
+
+        /** Backward shift deletion, keeps probe sequences intact without tombstones */
+        void erase_at( size_t hole ) {
+            size_t i = hole;
+            while( true ) {
+                i = ( i + 1 ) & mask;
+                if( !is_used( slots[i] ) ) {
+                    break;
+                }
+                const size_t wanted = home( slots[i].key );
+                // move the entry if its home is not cyclically within ( hole, i ]
+                const bool stays = hole <= i ? hole < wanted && wanted <= i :
+                                   hole < wanted || wanted <= i;
+                if( !stays ) {
+                    slots[hole] = slots[i];
+                    hole = i;
+                }
+            }
+            slots[hole].generation = generation - 1;
+            --entries;
+        }
+
+        size_t limit;
+        size_t mask = 0;
+        int shift_bits = 0;
+        size_t entries = 0;
+        size_t hand = 0;
+        uint32_t generation = 1;
+        std::vector<slot> slots;
+        mutable statistics counters;
+};
+
+#endif // CATA_SRC_CLOCK_CACHE_H
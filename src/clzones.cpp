@@ -118,6 +118,7 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    near_cache.clear();
 }
 
 std::string zone_type::name() const
@@ -590,6 +591,7 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
 void zone_manager::cache_data()
 {
     area_cache.clear();
+    near_cache.clear();
 
     for( const zone_data &elem : zones ) {
         if( !elem.get_enabled() ) {
@@ -610,6 +612,7 @@ void zone_manager::cache_data()
 void zone_manager::cache_vzones()
 {
     vzone_cache.clear();
+    near_cache.clear();
     map &here = get_map();
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z );
     for( zone_data *elem : vzones ) {
@@ -630,12 +633,13 @@ void zone_manager::cache_vzones()
     }
 }
 
-std::unordered_set<tripoint> zone_manager::get_point_set( const zone_type_id &type,
+const std::unordered_set<tripoint> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint> no_points;
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return no_points;
     }
 
     return type_iter->second;
@@ -666,18 +670,48 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
     return res;
 }
 
-std::unordered_set<tripoint> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
+    static const std::unordered_set<tripoint> no_points;
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return no_points;
     }
 
     return type_iter->second;
 }
 
+const std::unordered_set<tripoint> &zone_manager::get_near_points( const zone_type_id &type,
+        const tripoint &where, const int range, const faction_id &fac ) const
+{
+    // Only a handful of spots are asked about at a time, this keeps NPCs asking from everywhere
+    // from growing the cache without bound.
+    static constexpr size_t max_near_cache_size = 256;
+
+    auto key = std::make_tuple( zone_data::make_type_hash( type, fac ), where, range );
+    const auto iter = near_cache.find( key );
+    if( iter != near_cache.end() ) {
+        return iter->second;
+    }
+    if( near_cache.size() >= max_near_cache_size ) {
+        near_cache.clear();
+    }
+
+    std::unordered_set<tripoint> &near_points = near_cache[std::move( key )];
+    for( const std::unordered_set<tripoint> *points : {
+             &get_point_set( type, fac ), &get_vzone_set( type, fac )
+         } ) {
+        for( const tripoint &point : *points ) {
+            if( point.z == where.z && square_dist( point, where ) <= range ) {
+                near_points.insert( point );
+            }
+        }
+    }
+    return near_points;
+}
+
 bool zone_manager::has( const zone_type_id &type, const tripoint &where,
                         const faction_id &fac ) const
 {
@@ -689,25 +723,10 @@ bool zone_manager::has( const zone_type_id &type, const tripoint &where,
 bool zone_manager::has_near( const zone_type_id &type, const tripoint &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
-        }
-    }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
-        }
+    if( get_point_set( type, fac ).empty() && get_vzone_set( type, fac ).empty() ) {
+        return false;
     }
-
-    return false;
+    return !get_near_points( type, where, range, fac ).empty();
 }
 
 bool zone_manager::has_loot_dest_near( const tripoint &where ) const
@@ -760,38 +779,21 @@ bool zone_manager::custom_loot_has( const tripoint &where, const item *it ) cons
 std::unordered_set<tripoint> zone_manager::get_near( const zone_type_id &type,
         const tripoint &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    auto near_point_set = std::unordered_set<tripoint>();
-
-    for( const tripoint &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
-                    near_point_set.insert( point );
-                }
-            }
-        }
+    if( get_point_set( type, fac ).empty() && get_vzone_set( type, fac ).empty() ) {
+        return std::unordered_set<tripoint>();
+    }
+    const std::unordered_set<tripoint> &near_points = get_near_points( type, where, range, fac );
+    const zone_type_id loot_custom( "LOOT_CUSTOM" );
+    if( !it || ( get_point_set( loot_custom ).empty() && get_vzone_set( loot_custom ).empty() ) ) {
+        return near_points;
     }
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_type_id( "LOOT_CUSTOM" ), point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
-                    near_point_set.insert( point );
-                }
-            }
+    auto near_point_set = std::unordered_set<tripoint>();
+    for( const tripoint &point : near_points ) {
+        if( !has( loot_custom, point ) || custom_loot_has( point, it ) ) {
+            near_point_set.insert( point );
         }
     }
-
     return near_point_set;
 }
 
@@ -9,6 +9,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -356,11 +357,21 @@ class zone_manager
         std::map<zone_type_id, zone_type> types;
         std::unordered_map<std::string, std::unordered_set<tripoint>> area_cache;
         std::unordered_map<std::string, std::unordered_set<tripoint>> vzone_cache;
-        std::unordered_set<tripoint> get_point_set( const zone_type_id &type,
+        const std::unordered_set<tripoint> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
 
+        /**
+         * Tiles of zones (including vehicle zones) of the type within range of a point, keyed by
+         * type hash, point and range. Sorting loot asks about the same zones around the same
+         * spot for every item, so the answers are kept until the zones change.
+         */
+        mutable std::map<std::tuple<std::string, tripoint, int>, std::unordered_set<tripoint>>
+        near_cache;
+        const std::unordered_set<tripoint> &get_near_points( const zone_type_id &type,
+                const tripoint &where, int range, const faction_id &fac ) const;
+
         //Cache number of items already checked on each source tile when sorting
         std::unordered_map<tripoint, int> num_processed;
 
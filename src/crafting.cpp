@@ -69,6 +69,7 @@
 #include "rng.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
+#include "temp_crafting_inventory.h"
 #include "translations.h"
 #include "type_id.h"
 #include "ui.h"
@@ -582,6 +583,44 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
     return *crafting_cache.crafting_inventory;
 }
 
+void Character::form_crafting_inventory( temp_crafting_inventory &view, const tripoint &src_pos,
+        int radius, bool clear_path ) const
+{
+    const tripoint inv_pos = src_pos == tripoint_zero ? pos() : src_pos;
+    view.clear();
+    if( radius >= 0 ) {
+        // Only pseudo items end up in this inventory, everything else is referenced by view.
+        inventory pseudo_items;
+        pseudo_items.form_from_map( get_map(), inv_pos, radius, this, false, clear_path, &view );
+        for( const std::list<item> *stack : pseudo_items.const_slice() ) {
+            for( const item &it : *stack ) {
+                view.add_item_copy( it );
+            }
+        }
+    }
+
+    for( item_location &it : const_cast<Character *>( this )->all_items_loc() ) {
+        // can't craft with containers that have items in them
+        if( !it->contents.empty_container() ) {
+            continue;
+        }
+        view.add_item_ref( *it );
+    }
+
+    for( const bionic &bio : *my_bionics ) {
+        const bionic_data &bio_data = bio.info();
+        if( ( !bio_data.activated || bio.powered ) &&
+            !bio_data.fake_item.is_empty() ) {
+            view.add_item_copy( item( bio.info().fake_item, calendar::turn,
+                                      units::to_kilojoule( get_power_level() ) ) );
+        }
+    }
+    if( has_trait( trait_BURROW ) ) {
+        view.add_item_copy( item( "pickaxe", calendar::turn ) );
+        view.add_item_copy( item( "shovel", calendar::turn ) );
+    }
+}
+
 void Character::invalidate_crafting_inventory()
 {
     crafting_cache.time = calendar::before_time_starts;
@@ -2534,7 +2573,7 @@ void Character::complete_disassemble( item_location &target, const recipe &dis )
         }
     }
 
-    put_into_vehicle_or_drop( *this, item_drop_reason::deliberate, drop_items );
+    put_into_vehicle_or_drop( *this, item_drop_reason::deliberate, std::move( drop_items ) );
 
     if( !dis.learn_by_disassembly.empty() && !knows_recipe( &dis ) ) {
         if( can_decomp_learn( dis ) ) {
@@ -10,6 +10,7 @@
 #include <new>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -20,6 +21,7 @@
 #include "color.h"
 #include "crafting.h"
 #include "cursesdef.h"
+#include "flag.h"
 #include "input.h"
 #include "inventory.h"
 #include "item.h"
@@ -33,14 +35,20 @@
 #include "recipe.h"
 #include "recipe_dictionary.h"
 #include "requirements.h"
+#include "skill.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
+#include "temp_crafting_inventory.h"
 #include "translations.h"
 #include "type_id.h"
 #include "ui.h"
 #include "ui_manager.h"
 #include "uistate.h"
 
+static const itype_id itype_adv_UPS_off( "adv_UPS_off" );
+static const itype_id itype_UPS( "UPS" );
+static const itype_id itype_UPS_off( "UPS_off" );
+
 static const std::string flag_BLIND_EASY( "BLIND_EASY" );
 static const std::string flag_BLIND_HARD( "BLIND_HARD" );
 
@@ -127,18 +135,11 @@ static void translate_all()
     }
 }
 
-void reset_recipe_categories()
-{
-    craft_cat_list.clear();
-    craft_subcat_list.clear();
-}
-
 namespace
 {
 struct availability {
-    explicit availability( const recipe *r, int batch_size = 1 ) {
+    availability( const recipe *r, const read_only_visitable &inv, int batch_size = 1 ) {
         Character &player = get_player_character();
-        const inventory &inv = player.crafting_inventory();
         auto all_items_filter = r->get_component_filter( recipe_filter_flags::none );
         auto no_rotten_filter = r->get_component_filter( recipe_filter_flags::no_rotten );
         const deduped_requirement_data &req = r->deduped_requirements();
@@ -189,12 +190,151 @@ struct availability {
         }
     }
 };
+
+/**
+ * Availability of recipes, kept between openings of the crafting menu.
+ * Only recipes that use an item type whose amount or state changed since the
+ * last opening are checked again.
+ */
+class availability_index
+{
+    public:
+        /** Drops entries that may have changed since the inventory was last seen */
+        void update( const Character &crafter, const temp_crafting_inventory &inv );
+        const availability &get( const recipe *r, const temp_crafting_inventory &inv );
+        void clear();
+
+    private:
+        /** What availability checks can see of the items of one type */
+        struct type_state {
+            int items = 0;
+            int count = 0;
+            int ammo = 0;
+            int rotten = 0;
+            int frozen = 0;
+            int empty = 0;
+
+            bool operator==( const type_state &rhs ) const {
+                return items == rhs.items && count == rhs.count && ammo == rhs.ammo &&
+                       rotten == rhs.rotten && frozen == rhs.frozen && empty == rhs.empty;
+            }
+            bool operator!=( const type_state &rhs ) const {
+                return !( *this == rhs );
+            }
+        };
+        using type_states = std::unordered_map<itype_id, type_state>;
+
+        void invalidate_users( const itype_id &type );
+
+        const Character *owner = nullptr;
+        std::vector<int> skill_levels;
+        std::vector<proficiency_id> proficiencies;
+        type_states inventory;
+        std::unordered_map<const recipe *, availability> cache;
+};
+
+void availability_index::update( const Character &crafter, const temp_crafting_inventory &inv )
+{
+    std::vector<int> levels;
+    levels.reserve( Skill::skills.size() );
+    for( const Skill &sk : Skill::skills ) {
+        levels.push_back( crafter.get_skill_level( sk.ident() ) );
+    }
+    std::vector<proficiency_id> profs = crafter.known_proficiencies();
+    if( owner != &crafter || levels != skill_levels || profs != proficiencies ) {
+        clear();
+        owner = &crafter;
+        skill_levels = std::move( levels );
+        proficiencies = std::move( profs );
+    }
+
+    type_states current;
+    for( const auto &bin : inv.get_binned_items() ) {
+        type_state &state = current[bin.first];
+        for( const item *it : bin.second ) {
+            state.items++;
+            state.count += it->count();
+            state.ammo += it->ammo_remaining();
+            state.rotten += it->rotten() ? 1 : 0;
+            state.frozen += it->has_flag( flag_FROZEN ) ? 1 : 0;
+            state.empty += it->contents.empty_container() ? 1 : 0;
+        }
+    }
+
+    if( !cache.empty() ) {
+        for( const auto &e : current ) {
+            const auto iter = inventory.find( e.first );
+            if( iter == inventory.end() || iter->second != e.second ) {
+                invalidate_users( e.first );
+            }
+        }
+        for( const auto &e : inventory ) {
+            if( !current.count( e.first ) ) {
+                invalidate_users( e.first );
+            }
+        }
+    }
+    inventory = std::move( current );
+}
+
+void availability_index::invalidate_users( const itype_id &type )
+{
+    // UPS charges count for every tool that can run from a UPS
+    if( type == itype_UPS || type == itype_UPS_off || type == itype_adv_UPS_off ) {
+        cache.clear();
+        return;
+    }
+    for( const recipe *r : recipe_dict.using_item( type ) ) {
+        cache.erase( r );
+    }
+    if( !item::type_is_defined( type ) ) {
+        return;
+    }
+    for( const std::pair<const quality_id, int> &q : item::find_type( type )->qualities ) {
+        for( const recipe *r : recipe_dict.using_quality( q.first ) ) {
+            cache.erase( r );
+        }
+    }
+}
+
+const availability &availability_index::get( const recipe *r, const temp_crafting_inventory &inv )
+{
+    auto iter = cache.find( r );
+    if( iter == cache.end() ) {
+        iter = cache.emplace( r, availability( r, inv ) ).first;
+    }
+    return iter->second;
+}
+
+void availability_index::clear()
+{
+    owner = nullptr;
+    cache.clear();
+}
 } // namespace
 
+static availability_index recipe_availability;
+
+void reset_recipe_categories()
+{
+    craft_cat_list.clear();
+    craft_subcat_list.clear();
+    recipe_availability.clear();
+}
+
+recipe_availability_summary cached_recipe_availability( const recipe &r,
+        const temp_crafting_inventory &inv )
+{
+    recipe_availability.update( get_player_character(), inv );
+    const availability &avail = recipe_availability.get( &r, inv );
+    return { avail.can_craft, avail.has_all_skills };
+}
+
 static std::vector<std::string> recipe_info(
     const recipe &recp,
     const availability &avail,
     Character &guy,
+    const temp_crafting_inventory &crafting_inv,
     const std::string qry_comps,
     const int batch_size,
     const int fold_width,
@@ -242,7 +382,6 @@ static std::vector<std::string> recipe_info(
                           _( "Impossible" ) );
 
     std::string nearby_string;
-    const inventory &crafting_inv = guy.crafting_inventory();
     const int nearby_amount = crafting_inv.count_item( recp.result() );
     if( nearby_amount == 0 ) {
         nearby_string = "<color_light_gray>0</color>";
@@ -338,6 +477,7 @@ const recipe *select_crafting_recipe( int &batch_size_out )
             const recipe & recp,
             const availability & avail,
             Character & guy,
+            const temp_crafting_inventory & crafting_inv,
             const std::string qry_comps,
             const int batch_size,
             const int fold_width,
@@ -353,7 +493,7 @@ const recipe *select_crafting_recipe( int &batch_size_out )
             recipe_info_cache.batch_size = batch_size;
             recipe_info_cache.fold_width = fold_width;
             recipe_info_cache.text = recipe_info(
-                recp, avail, guy, qry_comps, batch_size, fold_width, color );
+                recp, avail, guy, crafting_inv, qry_comps, batch_size, fold_width, color );
         }
         return recipe_info_cache.text;
     };
@@ -501,12 +641,14 @@ const recipe *select_crafting_recipe( int &batch_size_out )
     const recipe *chosen = nullptr;
 
     Character &player_character = get_player_character();
-    const inventory &crafting_inv = player_character.crafting_inventory();
+    // Nothing moves while the menu is open, so items can be referenced instead of copied.
+    temp_crafting_inventory crafting_inv;
+    player_character.form_crafting_inventory( crafting_inv );
     const std::vector<npc *> helpers = player_character.get_crafting_helpers();
     std::string filterstring;
 
     const auto &available_recipes = player_character.get_available_recipes( crafting_inv, &helpers );
-    std::map<const recipe *, availability> availability_cache;
+    recipe_availability.update( player_character, crafting_inv );
 
     ui.on_redraw( [&]( const ui_adaptor & ) {
         const TAB_MODE m = ( batch ) ? BATCH : ( filterstring.empty() ) ? NORMAL : FILTERED;
@@ -625,7 +767,8 @@ const recipe *select_crafting_recipe( int &batch_size_out )
             }
 
             const std::vector<std::string> &info = cached_recipe_info(
-                    recp, avail, player_character, qry_comps, batch_size, fold_width, color );
+                    recp, avail, player_character, crafting_inv, qry_comps, batch_size, fold_width,
+                    color );
 
             const int total_lines = info.size();
             if( recipe_info_scroll < 0 ) {
@@ -684,7 +827,7 @@ const recipe *select_crafting_recipe( int &batch_size_out )
                 current.clear();
                 for( int i = 1; i <= 50; i++ ) {
                     current.push_back( chosen );
-                    available.emplace_back( chosen, i );
+                    available.emplace_back( chosen, crafting_inv, i );
                 }
             } else {
                 static_popup popup;
@@ -813,9 +956,7 @@ const recipe *select_crafting_recipe( int &batch_size_out )
                 available.reserve( current.size() );
                 // cache recipe availability on first display
                 for( const recipe *e : current ) {
-                    if( !availability_cache.count( e ) ) {
-                        availability_cache.emplace( e, availability( e ) );
-                    }
+                    recipe_availability.get( e, crafting_inv );
                 }
 
                 if( subtab.cur() != "CSC_*_RECENT" ) {
@@ -833,14 +974,14 @@ const recipe *select_crafting_recipe( int &batch_size_out )
 
                     std::stable_sort( current.begin(), current.end(),
                     [&]( const recipe * a, const recipe * b ) {
-                        return availability_cache.at( a ).can_craft &&
-                               !availability_cache.at( b ).can_craft;
+                        return recipe_availability.get( a, crafting_inv ).can_craft &&
+                               !recipe_availability.get( b, crafting_inv ).can_craft;
                     } );
                 }
 
                 std::transform( current.begin(), current.end(),
                 std::back_inserter( available ), [&]( const recipe * e ) {
-                    return availability_cache.at( e );
+                    return recipe_availability.get( e, crafting_inv );
                 } );
             }
 
@@ -7,9 +7,23 @@
 
 class JsonObject;
 class recipe;
+class temp_crafting_inventory;
 
 const recipe *select_crafting_recipe( int &batch_size_out );
 
+struct recipe_availability_summary {
+    bool can_craft = false;
+    bool has_all_skills = false;
+};
+
+/**
+ * Whether the player can craft the recipe with the inventory, as the crafting menu shows it.
+ * Uses the same cache as the menu, which only checks a recipe again once the inventory,
+ * skills or proficiencies changed in a way that can affect it.
+ */
+recipe_availability_summary cached_recipe_availability( const recipe &r,
+        const temp_crafting_inventory &inv );
+
 void load_recipe_category( const JsonObject &jsobj );
 void reset_recipe_categories();
 
@@ -286,7 +286,7 @@ bool Creature::sees( const Creature &critter ) const
         if( ch->is_crouching() ) {
             const int coverage = here.obstacle_coverage( pos(), critter.pos() );
             if( coverage < 30 ) {
-                return sees( critter.pos(), critter.is_avatar() ) && visible( ch );
+                return sees_position_of( critter ) && visible( ch );
             }
             float size_modifier = 1.0f;
             switch( ch->get_size() ) {
@@ -310,20 +310,26 @@ bool Creature::sees( const Creature &critter ) const
             }
             const int vision_modifier = 30 - 0.5 * coverage * size_modifier;
             if( vision_modifier > 1 ) {
-                return sees( critter.pos(), critter.is_avatar(), vision_modifier ) && visible( ch );
+                return sees_position_of( critter, vision_modifier ) && visible( ch );
             }
             return false;
         }
     }
-    return sees( critter.pos(), critter.is_avatar() ) && visible( ch );
+    return sees_position_of( critter ) && visible( ch );
 }
 
-bool Creature::sees( const tripoint &t, bool is_avatar, int range_mod ) const
+bool Creature::sees_position_of( const Creature &critter, const int range_mod ) const
 {
-    if( !fov_3d && posz() != t.z ) {
-        return false;
+    if( !is_monster() || !critter.is_npc() || ( !fov_3d && posz() != critter.posz() ) ) {
+        return sees( critter.pos(), critter.is_avatar(), range_mod );
     }
+    // Many monsters may look at the same NPC, use the field of view of the NPC for all of them.
+    const int range = sight_range_to( critter.pos(), range_mod );
+    return range >= 0 && get_map().sees_with_fov( critter.pos(), pos(), range );
+}
 
+int Creature::sight_range_to( const tripoint &t, int range_mod ) const
+{
     map &here = get_map();
     const int range_cur = sight_range( here.ambient_light_at( t ) );
     const int range_day = sight_range( default_daylight_level() );
@@ -346,18 +352,34 @@ bool Creature::sees( const tripoint &t, bool is_avatar, int range_mod ) const
         if( range_mod > 0 ) {
             range = std::min( range, range_mod );
         }
-        if( is_avatar ) {
-            // Special case monster -> player visibility, forcing it to be symmetric with player vision.
-            const float player_visibility_factor = get_player_character().visibility() / 100.0f;
-            int adj_range = std::floor( range * player_visibility_factor );
-            return adj_range >= wanted_range &&
-                   here.get_cache_ref( pos().z ).seen_cache[pos().x][pos().y] > LIGHT_TRANSPARENCY_SOLID;
-        } else {
-            return here.sees( pos(), t, range );
-        }
-    } else {
+        return range;
+    }
+    return -1;
+}
+
+bool Creature::sees( const tripoint &t, bool is_avatar, int range_mod ) const
+{
+    if( !fov_3d && posz() != t.z ) {
+        return false;
+    }
+
+    const int range = sight_range_to( t, range_mod );
+    if( range < 0 ) {
         return false;
     }
+    map &here = get_map();
+    if( is_avatar ) {
+        // Special case monster -> player visibility, forcing it to be symmetric with player vision.
+        const float player_visibility_factor = get_player_character().visibility() / 100.0f;
+        int adj_range = std::floor( range * player_visibility_factor );
+        return adj_range >= rl_dist( pos(), t ) &&
+               here.get_cache_ref( pos().z ).seen_cache[pos().x][pos().y] > LIGHT_TRANSPARENCY_SOLID;
+    } else if( is_npc() ) {
+        // NPCs check many places per turn, share one field of view for all of them.
+        return here.sees_with_fov( pos(), t, range );
+    } else {
+        return here.sees( pos(), t, range );
+    }
 }
 
 // Helper function to check if potential area of effect of a weapon overlaps vehicle
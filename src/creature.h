@@ -1247,6 +1247,10 @@ class Creature : public location, public viewer
         // do messaging and SCT for projectile hit
         void messaging_projectile_attack( const Creature *source,
                                           const projectile_attack_results &hit_selection, int total_damage ) const;
+        // how far away something at t can be seen given the light there, negative if not at all
+        int sight_range_to( const tripoint &t, int range_mod ) const;
+        // whether the position of critter is in sight, the last step of sees( const Creature & )
+        bool sees_position_of( const Creature &critter, int range_mod = 0 ) const;
 };
 
 #endif // CATA_SRC_CREATURE_H
@@ -5,7 +5,10 @@
 #include <utility>
 #if defined(TILES) || defined(_WIN32)
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -33,14 +36,74 @@ struct pairs {
     base_color BG;
 };
 
+/**
+ * The UTF-8 text of a single cell: one character and any zero width characters that
+ * follow it. Stored inline, so cells can be copied and compared without allocating.
+ * Longer sequences are cut at a character boundary.
+ */
+class cell_text
+{
+    public:
+        static constexpr size_t capacity = 11;
+
+        cell_text() = default;
+        cell_text( const char *s, size_t n ) {
+            assign( s, n );
+        }
+
+        void assign( const char *s, size_t n ) {
+            if( n > capacity ) {
+                n = capacity;
+                // don't keep the start of a character without its continuation bytes
+                while( n > 0 && ( static_cast<unsigned char>( s[n] ) & 0xC0 ) == 0x80 ) {
+                    n--;
+                }
+            }
+            std::copy( s, s + n, buf.begin() );
+            len = static_cast<unsigned char>( n );
+        }
+        void clear() {
+            len = 0;
+        }
+
+        bool empty() const {
+            return len == 0;
+        }
+        size_t size() const {
+            return len;
+        }
+        char operator[]( size_t i ) const {
+            return buf[i];
+        }
+        bool is_space() const {
+            return len == 1 && buf[0] == ' ';
+        }
+        /** First code point of the text, see @ref UTF8_getch */
+        uint32_t codepoint() const;
+        std::string str() const {
+            return std::string( buf.data(), len );
+        }
+
+        bool operator==( const cell_text &rhs ) const {
+            return len == rhs.len && std::equal( buf.begin(), buf.begin() + len, rhs.buf.begin() );
+        }
+        bool operator!=( const cell_text &rhs ) const {
+            return !( *this == rhs );
+        }
+
+    private:
+        std::array<char, capacity> buf = {};
+        unsigned char len = 0;
+};
+
 //Individual lines, so that we can track changed lines
 struct cursecell {
-    std::string ch;
+    cell_text ch;
     base_color FG = static_cast<base_color>( 0 );
     base_color BG = static_cast<base_color>( 0 );
 
-    explicit cursecell( std::string ch ) : ch( std::move( ch ) ) { }
-    cursecell() : cursecell( std::string( 1, ' ' ) ) { }
+    explicit cursecell( const std::string &ch ) : ch( ch.data(), ch.size() ) { }
+    cursecell() : ch( " ", 1 ) { }
 
     bool operator==( const cursecell &b ) const {
         return FG == b.FG && BG == b.BG && ch == b.ch;
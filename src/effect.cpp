@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <map>
+#include <string>
 #include <unordered_set>
 
 #include "bodypart.h"
@@ -237,10 +238,24 @@ void weed_msg( player &p )
     }
 }
 
+static effect_type::mod_value mod_value_from_string( const std::string &arg_key )
+{
+    static const std::map<std::string, effect_type::mod_value> values = {
+        { "min", effect_type::mod_min },
+        { "max", effect_type::mod_max },
+        { "amount", effect_type::mod_amount },
+        { "min_val", effect_type::mod_min_val },
+        { "max_val", effect_type::mod_max_val },
+        { "chance_top", effect_type::mod_chance_top },
+        { "chance_bot", effect_type::mod_chance_bot },
+        { "tick", effect_type::mod_tick },
+    };
+    return values.at( arg_key );
+}
+
 static void extract_effect(
     const JsonObject &j,
-    std::unordered_map<std::tuple<std::string, bool, std::string, std::string>, double,
-    cata::tuple_hash> &data,
+    std::array<std::unordered_map<std::string, effect_type::mod_values>, 2> &data,
     const std::string &mod_type, const std::string &data_key,
     const std::string &type_key, const std::string &arg_key )
 {
@@ -257,11 +272,15 @@ static void extract_effect(
         }
     }
     // Store values if they aren't zero.
+    const bool scaling = data_key == "scaling_mods";
+    const effect_type::mod_value value = mod_value_from_string( arg_key );
     if( val != 0 ) {
-        data[std::make_tuple( data_key, false, type_key, arg_key )] = val;
+        effect_type::mod_values &mods = data[0][type_key];
+        ( scaling ? mods.scaling : mods.base )[value] = val;
     }
     if( reduced_val != 0 ) {
-        data[std::make_tuple( data_key, true, type_key, arg_key )] = reduced_val;
+        effect_type::mod_values &mods = data[1][type_key];
+        ( scaling ? mods.scaling : mods.base )[value] = reduced_val;
     }
 }
 
@@ -418,6 +437,15 @@ bool effect_type::load_mod_data( const JsonObject &jo, const std::string &member
     }
 }
 
+const effect_type::mod_values &effect_type::get_mod_values( const std::string &type,
+        bool reduced ) const
+{
+    static const mod_values no_values;
+    const std::unordered_map<std::string, mod_values> &values = mod_data[reduced ? 1 : 0];
+    const auto found = values.find( type );
+    return found == values.end() ? no_values : found->second;
+}
+
 void effect_type::check_consistency()
 {
     for( const std::pair<efftype_id, effect_type> check : effect_types ) {
@@ -1008,27 +1036,16 @@ std::vector<efftype_id> effect::get_blocks_effects() const
 
 int effect::get_mod( const std::string &arg, bool reduced ) const
 {
-    const auto &mod_data = eff_type->mod_data;
-    double min = 0;
-    double max = 0;
+    const effect_type::mod_values &mods = eff_type->get_mod_values( arg, reduced );
+    const int scale = get_effective_intensity() - 1;
     // Get the minimum total
-    auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "min" ) );
-    if( found != mod_data.end() ) {
-        min += found->second;
-    }
-    found = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "min" ) );
-    if( found != mod_data.end() ) {
-        min += found->second * ( get_effective_intensity() - 1 );
-    }
+    double min = 0;
+    min += mods.base[effect_type::mod_min];
+    min += mods.scaling[effect_type::mod_min] * scale;
     // Get the maximum total
-    found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "max" ) );
-    if( found != mod_data.end() ) {
-        max += found->second;
-    }
-    found = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "max" ) );
-    if( found != mod_data.end() ) {
-        max += found->second * ( get_effective_intensity() - 1 );
-    }
+    double max = 0;
+    max += mods.base[effect_type::mod_max];
+    max += mods.scaling[effect_type::mod_max] * scale;
     if( static_cast<int>( max ) != 0 ) {
         // Return a random value between [min, max]
         return static_cast<int>( rng( min, max ) );
@@ -1040,27 +1057,16 @@ int effect::get_mod( const std::string &arg, bool reduced ) const
 
 int effect::get_avg_mod( const std::string &arg, bool reduced ) const
 {
-    const auto &mod_data = eff_type->mod_data;
-    double min = 0;
-    double max = 0;
+    const effect_type::mod_values &mods = eff_type->get_mod_values( arg, reduced );
+    const int scale = get_effective_intensity() - 1;
     // Get the minimum total
-    auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "min" ) );
-    if( found != mod_data.end() ) {
-        min += found->second;
-    }
-    found = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "min" ) );
-    if( found != mod_data.end() ) {
-        min += found->second * ( get_effective_intensity() - 1 );
-    }
+    double min = 0;
+    min += mods.base[effect_type::mod_min];
+    min += mods.scaling[effect_type::mod_min] * scale;
     // Get the maximum total
-    found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "max" ) );
-    if( found != mod_data.end() ) {
-        max += found->second;
-    }
-    found = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "max" ) );
-    if( found != mod_data.end() ) {
-        max += found->second * ( get_effective_intensity() - 1 );
-    }
+    double max = 0;
+    max += mods.base[effect_type::mod_max];
+    max += mods.scaling[effect_type::mod_max] * scale;
     if( static_cast<int>( max ) != 0 ) {
         // Return an average of min and max
         return static_cast<int>( ( min + max ) / 2 );
@@ -1072,46 +1078,28 @@ int effect::get_avg_mod( const std::string &arg, bool reduced ) const
 
 int effect::get_amount( const std::string &arg, bool reduced ) const
 {
-    const auto &mod_data = eff_type->mod_data;
+    const effect_type::mod_values &mods = eff_type->get_mod_values( arg, reduced );
     double ret = 0;
-    auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "amount" ) );
-    if( found != mod_data.end() ) {
-        ret += found->second;
-    }
-    found = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "amount" ) );
-    if( found != mod_data.end() ) {
-        ret += found->second * ( get_effective_intensity() - 1 );
-    }
+    ret += mods.base[effect_type::mod_amount];
+    ret += mods.scaling[effect_type::mod_amount] * ( get_effective_intensity() - 1 );
     return static_cast<int>( ret );
 }
 
 int effect::get_min_val( const std::string &arg, bool reduced ) const
 {
-    const auto &mod_data = eff_type->mod_data;
+    const effect_type::mod_values &mods = eff_type->get_mod_values( arg, reduced );
     double ret = 0;
-    auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "min_val" ) );
-    if( found != mod_data.end() ) {
-        ret += found->second;
-    }
-    found = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "min_val" ) );
-    if( found != mod_data.end() ) {
-        ret += found->second * ( intensity - 1 );
-    }
+    ret += mods.base[effect_type::mod_min_val];
+    ret += mods.scaling[effect_type::mod_min_val] * ( intensity - 1 );
     return static_cast<int>( ret );
 }
 
 int effect::get_max_val( const std::string &arg, bool reduced ) const
 {
-    const auto &mod_data = eff_type->mod_data;
+    const effect_type::mod_values &mods = eff_type->get_mod_values( arg, reduced );
     double ret = 0;
-    auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "max_val" ) );
-    if( found != mod_data.end() ) {
-        ret += found->second;
-    }
-    found = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "max_val" ) );
-    if( found != mod_data.end() ) {
-        ret += found->second * ( intensity - 1 );
-    }
+    ret += mods.base[effect_type::mod_max_val];
+    ret += mods.scaling[effect_type::mod_max_val] * ( intensity - 1 );
     return static_cast<int>( ret );
 }
 
@@ -1127,19 +1115,10 @@ bool effect::get_sizing( const std::string &arg ) const
 
 double effect::get_percentage( const std::string &arg, int val, bool reduced ) const
 {
-    const auto &mod_data = eff_type->mod_data;
-    auto found_top_base = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "chance_top" ) );
-    auto found_top_scale = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg,
-                                          "chance_top" ) );
+    const effect_type::mod_values &mods = eff_type->get_mod_values( arg, reduced );
     // Convert to int or 0
-    int top_base = 0;
-    int top_scale = 0;
-    if( found_top_base != mod_data.end() ) {
-        top_base = found_top_base->second;
-    }
-    if( found_top_scale != mod_data.end() ) {
-        top_scale = found_top_scale->second * ( intensity - 1 );
-    }
+    const int top_base = mods.base[effect_type::mod_chance_top];
+    const int top_scale = mods.scaling[effect_type::mod_chance_top] * ( intensity - 1 );
     // Check chances if value is 0 (so we can check valueless effects like vomiting)
     // Else a nonzero value overrides a 0 chance for default purposes
     if( val == 0 ) {
@@ -1154,26 +1133,11 @@ double effect::get_percentage( const std::string &arg, int val, bool reduced ) c
     }
 
     // We only need to calculate these if we haven't already returned
-    int bot_base = 0;
-    int bot_scale = 0;
+    const int bot_base = mods.base[effect_type::mod_chance_bot];
+    const int bot_scale = mods.scaling[effect_type::mod_chance_bot] * ( intensity - 1 );
     int tick = 0;
-    auto found_bot_base = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "chance_bot" ) );
-    auto found_bot_scale = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg,
-                                          "chance_bot" ) );
-    auto found_tick_base = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "tick" ) );
-    auto found_tick_scale = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "tick" ) );
-    if( found_bot_base != mod_data.end() ) {
-        bot_base = found_bot_base->second;
-    }
-    if( found_bot_scale != mod_data.end() ) {
-        bot_scale = found_bot_scale->second * ( intensity - 1 );
-    }
-    if( found_tick_base != mod_data.end() ) {
-        tick += found_tick_base->second;
-    }
-    if( found_tick_scale != mod_data.end() ) {
-        tick += found_tick_scale->second * ( intensity - 1 );
-    }
+    tick += mods.base[effect_type::mod_tick];
+    tick += mods.scaling[effect_type::mod_tick] * ( intensity - 1 );
     // Tick is the exception where tick = 0 means tick = 1
     if( tick == 0 ) {
         tick = 1;
@@ -1205,19 +1169,10 @@ double effect::get_percentage( const std::string &arg, int val, bool reduced ) c
 bool effect::activated( const time_point &when, const std::string &arg, int val, bool reduced,
                         double mod ) const
 {
-    const auto &mod_data = eff_type->mod_data;
-    auto found_top_base = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "chance_top" ) );
-    auto found_top_scale = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg,
-                                          "chance_top" ) );
+    const effect_type::mod_values &mods = eff_type->get_mod_values( arg, reduced );
     // Convert to int or 0
-    int top_base = 0;
-    int top_scale = 0;
-    if( found_top_base != mod_data.end() ) {
-        top_base = found_top_base->second;
-    }
-    if( found_top_scale != mod_data.end() ) {
-        top_scale = found_top_scale->second * ( intensity - 1 );
-    }
+    const int top_base = mods.base[effect_type::mod_chance_top];
+    const int top_scale = mods.scaling[effect_type::mod_chance_top] * ( intensity - 1 );
     // Check chances if value is 0 (so we can check valueless effects like vomiting)
     // Else a nonzero value overrides a 0 chance for default purposes
     if( val == 0 ) {
@@ -1232,26 +1187,11 @@ bool effect::activated( const time_point &when, const std::string &arg, int val,
     }
 
     // We only need to calculate these if we haven't already returned
-    int bot_base = 0;
-    int bot_scale = 0;
+    const int bot_base = mods.base[effect_type::mod_chance_bot];
+    const int bot_scale = mods.scaling[effect_type::mod_chance_bot] * ( intensity - 1 );
     int tick = 0;
-    auto found_bot_base = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "chance_bot" ) );
-    auto found_bot_scale = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg,
-                                          "chance_bot" ) );
-    auto found_tick_base = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "tick" ) );
-    auto found_tick_scale = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg, "tick" ) );
-    if( found_bot_base != mod_data.end() ) {
-        bot_base = found_bot_base->second;
-    }
-    if( found_bot_scale != mod_data.end() ) {
-        bot_scale = found_bot_scale->second * ( intensity - 1 );
-    }
-    if( found_tick_base != mod_data.end() ) {
-        tick += found_tick_base->second;
-    }
-    if( found_tick_scale != mod_data.end() ) {
-        tick += found_tick_scale->second * ( intensity - 1 );
-    }
+    tick += mods.base[effect_type::mod_tick];
+    tick += mods.scaling[effect_type::mod_tick] * ( intensity - 1 );
     // Tick is the exception where tick = 0 means tick = 1
     if( tick == 0 ) {
         tick = 1;
@@ -2,11 +2,11 @@
 #ifndef CATA_SRC_EFFECT_H
 #define CATA_SRC_EFFECT_H
 
+#include <array>
 #include <iosfwd>
 #include <map>
 #include <set>
 #include <string>
-#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -14,7 +14,6 @@
 #include "calendar.h"
 #include "color.h"
 #include "effect_source.h"
-#include "hash_utils.h"
 #include "translations.h"
 #include "type_id.h"
 
@@ -73,6 +72,24 @@ class effect_type
             female,
         };
 
+        /** The values a type of mod (like "PAIN") can have, see @ref mod_values. */
+        enum mod_value : int {
+            mod_min,
+            mod_max,
+            mod_amount,
+            mod_min_val,
+            mod_max_val,
+            mod_chance_top,
+            mod_chance_bot,
+            mod_tick,
+            num_mod_values
+        };
+        /** Values of one type of mod from "base_mods" and "scaling_mods", zero if not given. */
+        struct mod_values {
+            std::array<double, num_mod_values> base = {};
+            std::array<double, num_mod_values> scaling = {};
+        };
+
         effect_type() = default;
 
         efftype_id id;
@@ -185,9 +202,13 @@ class effect_type
         translation death_msg;
         cata::optional<event_type> death_event;
 
-        /** Key tuple order is:("base_mods"/"scaling_mods", reduced: bool, type of mod: "STR", desired argument: "tick") */
-        std::unordered_map <
-        std::tuple<std::string, bool, std::string, std::string>, double, cata::tuple_hash > mod_data;
+        /**
+         * Values per type of mod, the first map is used when the effect is not reduced and the
+         * second one when it is. Effects look their mods up every turn, so this is a single
+         * lookup instead of one per value.
+         */
+        std::array<std::unordered_map<std::string, mod_values>, 2> mod_data;
+        const mod_values &get_mod_values( const std::string &type, bool reduced ) const;
         std::vector<vitamin_rate_effect> vitamin_data;
         std::vector<std::pair<int, int>> kill_chance;
         std::vector<std::pair<int, int>> red_kill_chance;
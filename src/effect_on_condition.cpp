@@ -83,6 +83,11 @@ void effect_on_conditions::queue_effect_on_condition( time_duration duration,
 
 void effect_on_conditions::process_effect_on_conditions()
 {
+    // Most turns nothing is due, so skip setting up the dialogue
+    if( g->queued_effect_on_conditions.empty() ||
+        g->queued_effect_on_conditions.top().time > calendar::turn ) {
+        return;
+    }
     dialogue d;
     standard_npc default_npc( "Default" );
     d.alpha = get_talker_for( get_avatar() );
@@ -732,17 +732,55 @@ struct event_spec<event_type::uses_debug_menu> {
 template<event_type Type, typename IndexSequence>
 struct make_event_helper;
 
+constexpr bool same_field_name( const char *l, const char *r )
+{
+    while( *l != '\0' && *l == *r ) {
+        ++l;
+        ++r;
+    }
+    return *l == *r;
+}
+
+template<event_type Type>
+constexpr size_t field_index( const char *name )
+{
+    using Spec = event_spec<Type>;
+    for( size_t i = 0; i < Spec::fields.size(); ++i ) {
+        if( same_field_name( Spec::fields[i].first, name ) ) {
+            return i;
+        }
+    }
+    return Spec::fields.size();
+}
+
 } // namespace event_detail
 
 class event
 {
     public:
         using data_type = std::map<std::string, cata_variant>;
+        using field_spec = std::pair<const char *, cata_variant_type>;
+        // The largest number of fields in any event_spec
+        static constexpr size_t max_fields = 6;
+        using values_type = std::array<cata_variant, max_fields>;
 
+        // Event with arbitrary fields, as produced by event_transformation.
         event( event_type type, time_point time, data_type &&data )
             : type_( type )
             , time_( time )
             , data_( std::move( data ) )
+            , data_valid_( true )
+        {}
+
+        // Event laid out like its event_spec; the values are in the order of
+        // the fields.  Use make to construct these.
+        event( event_type type, time_point time, const field_spec *fields, size_t num_fields,
+               values_type &&values )
+            : type_( type )
+            , time_( time )
+            , fields_( fields )
+            , num_fields_( num_fields )
+            , values_( std::move( values ) )
         {}
 
         // Call this to construct an event in a type-safe manner.  It will
@@ -757,6 +795,8 @@ class event
                            "spec for this event type must be defined and empty" );
             static_assert( sizeof...( Args ) == Spec::fields.size(),
                            "wrong number of arguments for event type" );
+            static_assert( Spec::fields.size() <= max_fields,
+                           "event::max_fields must be raised for this event type" );
 
             return event_detail::make_event_helper <
                    Type, std::make_index_sequence<sizeof...( Args )>
@@ -774,21 +814,21 @@ class event
         }
 
         cata_variant get_variant( const std::string &key ) const {
-            auto it = data_.find( key );
-            if( it == data_.end() ) {
+            const cata_variant *value = find( key );
+            if( value == nullptr ) {
                 debugmsg( "No such key %s in event of type %s", key,
                           io::enum_to_string( type_ ) );
                 abort();
             }
-            return it->second;
+            return *value;
         }
 
         cata_variant get_variant_or_void( const std::string &key ) const {
-            auto it = data_.find( key );
-            if( it == data_.end() ) {
+            const cata_variant *value = find( key );
+            if( value == nullptr ) {
                 return cata_variant();
             }
-            return it->second;
+            return *value;
         }
 
         template<cata_variant_type Type>
@@ -801,13 +841,71 @@ class event
             return get_variant( key ).get<T>();
         }
 
+        // Index of the field called name in the event_spec of Type, to give the
+        // indices passed to get a name.  Unknown names fail to compile in get.
+        template<event_type Type>
+        static constexpr size_t field( const char *name ) {
+            return event_detail::field_index<Type>( name );
+        }
+
+        // Field number I of an event of the given type, without looking up its
+        // name.  The value type is checked at compile time.  Events built from
+        // a data map still need the lookup.
+        template<event_type Type, size_t I>
+        auto get() const {
+            using Spec = event_detail::event_spec<Type>;
+            static_assert( I < Spec::fields.size(), "no field with this index in event type" );
+            constexpr cata_variant_type value_type = Spec::fields[I].second;
+            if( type_ != Type ) {
+                debugmsg( "Tried to read field %d of %s from event of type %s",
+                          static_cast<int>( I ), io::enum_to_string( Type ),
+                          io::enum_to_string( type_ ) );
+                abort();
+            }
+            if( fields_ == nullptr ) {
+                return get_variant( Spec::fields[I].first ).template get<value_type>();
+            }
+            return values_[I].get<value_type>();
+        }
+
+        // The values in the order of the event_spec fields, or null for events
+        // built from a data map.
+        const values_type *values() const {
+            return fields_ == nullptr ? nullptr : &values_;
+        }
+
+        // The fields by name.  For events made from their event_spec this is
+        // only built when first asked for.
         const data_type &data() const {
+            if( !data_valid_ ) {
+                for( size_t i = 0; i < num_fields_; ++i ) {
+                    data_.emplace( fields_[i].first, values_[i] );
+                }
+                data_valid_ = true;
+            }
             return data_;
         }
     private:
+        const cata_variant *find( const std::string &key ) const {
+            if( fields_ == nullptr ) {
+                auto it = data_.find( key );
+                return it == data_.end() ? nullptr : &it->second;
+            }
+            for( size_t i = 0; i < num_fields_; ++i ) {
+                if( key == fields_[i].first ) {
+                    return &values_[i];
+                }
+            }
+            return nullptr;
+        }
+
         event_type type_;
         time_point time_;
-        data_type data_;
+        const field_spec *fields_ = nullptr;
+        size_t num_fields_ = 0;
+        values_type values_;
+        mutable data_type data_;
+        mutable bool data_valid_ = false;
 };
 
 namespace event_detail
@@ -815,17 +913,18 @@ namespace event_detail
 
 template<event_type Type, size_t... I>
 struct make_event_helper<Type, std::index_sequence<I...>> {
-    using Spec = event_spec<Type>;
+    using Spec = event_detail::event_spec<Type>;
 
     template<typename... Args>
     event operator()( time_point time, Args &&... args ) {
         return event(
                    Type,
                    time,
-        std::map<std::string, cata_variant> { {
-                Spec::fields[I].first,
-                cata_variant::make<Spec::fields[I].second>( args )
-            } ...
+                   Spec::fields.data(),
+                   Spec::fields.size(),
+        event::values_type { {
+                cata_variant::make<Spec::fields[I].second>( args )...
+            }
         } );
     }
 };
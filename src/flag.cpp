@@ -1,6 +1,10 @@
 #include "flag.h"
 
+#include <deque>
+#include <unordered_map>
+
 #include "debug.h"
+#include "flag_set.h"
 #include "generic_factory.h"
 #include "json.h"
 #include "type_id.h"
@@ -398,3 +402,130 @@ const std::vector<json_flag> &json_flag::get_all()
 {
     return json_flags_all.get_all();
 }
+
+namespace
+{
+/** Bits used by flag_set, handed out on first use and kept for the whole session */
+struct flag_bit_registry {
+    // flag of each bit, a deque so that references stay valid while bits are added
+    std::deque<flag_id> flags;
+    std::unordered_map<flag_id, int> bits;
+    // bit of each loaded json flag, indexed by its int id
+    std::vector<int> loaded_bits;
+    generic_factory<json_flag>::Version loaded_version;
+
+    int add( const flag_id &flag ) {
+        const auto iter = bits.find( flag );
+        if( iter != bits.end() ) {
+            return iter->second;
+        }
+        const int bit = static_cast<int>( flags.size() );
+        flags.push_back( flag );
+        bits.emplace( flag, bit );
+        return bit;
+    }
+};
+
+flag_bit_registry &get_flag_bits()
+{
+    static flag_bit_registry registry;
+    return registry;
+}
+} // namespace
+
+int flag_set::find_bit( const flag_id &flag )
+{
+    flag_bit_registry &registry = get_flag_bits();
+    // the int id is cached in the string_id, so loaded flags don't need a hash lookup
+    const int cid = json_flags_all.convert( flag, int_id<json_flag>( -1 ), false ).to_i();
+    if( cid >= 0 ) {
+        if( !json_flags_all.is_valid( registry.loaded_version ) ) {
+            registry.loaded_bits.clear();
+            for( const json_flag &f : json_flags_all.get_all() ) {
+                registry.loaded_bits.push_back( registry.add( f.id ) );
+            }
+            registry.loaded_version = json_flags_all.get_version();
+        }
+        return registry.loaded_bits[cid];
+    }
+    const auto iter = registry.bits.find( flag );
+    return iter != registry.bits.end() ? iter->second : -1;
+}
+
+int flag_set::find_or_add_bit( const flag_id &flag )
+{
+    const int bit = find_bit( flag );
+    return bit >= 0 ? bit : get_flag_bits().add( flag );
+}
+
+const flag_id &flag_set::flag_at( size_type bit )
+{
+    return get_flag_bits().flags[bit];
+}
+
+flag_set::size_type flag_set::size() const
+{
+    size_type result = 0;
+    for( word_type w : words ) {
+        for( ; w != 0; w &= w - 1 ) {
+            result++;
+        }
+    }
+    return result;
+}
+
+std::pair<flag_set::iterator, bool> flag_set::insert( const flag_id &flag )
+{
+    const size_type bit = find_or_add_bit( flag );
+    const size_type w = bit / word_bits;
+    if( w >= words.size() ) {
+        words.resize( w + 1, 0 );
+    }
+    const word_type mask = word_type( 1 ) << ( bit % word_bits );
+    const bool inserted = ( words[w] & mask ) == 0;
+    words[w] |= mask;
+    return { const_iterator( this, bit ), inserted };
+}
+
+flag_set::size_type flag_set::erase( const flag_id &flag )
+{
+    const int bit = find_bit( flag );
+    if( bit < 0 || !test( bit ) ) {
+        return 0;
+    }
+    words[bit / word_bits] &= ~( word_type( 1 ) << ( bit % word_bits ) );
+    trim();
+    return 1;
+}
+
+flag_set::iterator flag_set::erase( const_iterator pos )
+{
+    words[pos.bit / word_bits] &= ~( word_type( 1 ) << ( pos.bit % word_bits ) );
+    trim();
+    return const_iterator( this, next_bit( pos.bit + 1 ) );
+}
+
+flag_set::size_type flag_set::next_bit( size_type bit ) const
+{
+    for( size_type w = bit / word_bits; w < words.size(); w++ ) {
+        word_type word = words[w];
+        if( w == bit / word_bits ) {
+            word &= ~word_type( 0 ) << ( bit % word_bits );
+        }
+        if( word != 0 ) {
+            size_type b = w * word_bits;
+            for( ; ( word & 1 ) == 0; word >>= 1 ) {
+                b++;
+            }
+            return b;
+        }
+    }
+    return npos;
+}
+
+void flag_set::trim()
+{
+    while( !words.empty() && words.back() == 0 ) {
+        words.pop_back();
+    }
+}
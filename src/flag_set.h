@@ -0,0 +1,141 @@
+#pragma once
+#ifndef CATA_SRC_FLAG_SET_H
+#define CATA_SRC_FLAG_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "type_id.h"
+
+/**
+ * Set of flags stored as a bitset, used for the flags of items and item types.
+ *
+ * Every flag gets a bit the first time it is added to any set, loaded json flags are given
+ * their bits when they are first looked up. Bits are never reused, so sets stay valid when
+ * flag definitions are reloaded. Lookups are a bit test, iteration is in bit order.
+ */
+class flag_set
+{
+    public:
+        using key_type = flag_id;
+        using value_type = flag_id;
+        using size_type = std::size_t;
+
+        class const_iterator
+        {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = flag_id;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const flag_id *;
+                using reference = const flag_id &;
+
+                const_iterator() = default;
+
+                reference operator*() const;
+                pointer operator->() const {
+                    return &**this;
+                }
+                const_iterator &operator++() {
+                    bit = set->next_bit( bit + 1 );
+                    return *this;
+                }
+                const_iterator operator++( int ) {
+                    const_iterator prev = *this;
+                    ++*this;
+                    return prev;
+                }
+                bool operator==( const const_iterator &rhs ) const {
+                    return bit == rhs.bit;
+                }
+                bool operator!=( const const_iterator &rhs ) const {
+                    return bit != rhs.bit;
+                }
+
+            private:
+                friend class flag_set;
+                const_iterator( const flag_set *set, size_type bit ) : set( set ), bit( bit ) {}
+
+                const flag_set *set = nullptr;
+                size_type bit = 0;
+        };
+        using iterator = const_iterator;
+
+        flag_set() = default;
+        template<typename InputIt>
+        flag_set( InputIt first, InputIt last ) {
+            insert( first, last );
+        }
+        flag_set( std::initializer_list<flag_id> init ) : flag_set( init.begin(), init.end() ) {}
+
+        const_iterator begin() const {
+            return const_iterator( this, next_bit( 0 ) );
+        }
+        const_iterator end() const {
+            return const_iterator( this, npos );
+        }
+
+        bool empty() const {
+            return words.empty();
+        }
+        size_type size() const;
+
+        size_type count( const flag_id &flag ) const {
+            const int bit = find_bit( flag );
+            return bit >= 0 && test( bit ) ? 1 : 0;
+        }
+
+        std::pair<iterator, bool> insert( const flag_id &flag );
+        template<typename InputIt>
+        void insert( InputIt first, InputIt last ) {
+            for( ; first != last; ++first ) {
+                insert( *first );
+            }
+        }
+
+        size_type erase( const flag_id &flag );
+        iterator erase( const_iterator pos );
+
+        void clear() {
+            words.clear();
+        }
+
+        bool operator==( const flag_set &rhs ) const {
+            return words == rhs.words;
+        }
+        bool operator!=( const flag_set &rhs ) const {
+            return words != rhs.words;
+        }
+
+    private:
+        using word_type = std::uint64_t;
+        static constexpr size_type word_bits = 64;
+        static constexpr size_type npos = static_cast<size_type>( -1 );
+
+        /** Bit of the flag, or -1 if no set has ever contained it */
+        static int find_bit( const flag_id &flag );
+        static int find_or_add_bit( const flag_id &flag );
+        static const flag_id &flag_at( size_type bit );
+
+        bool test( size_type bit ) const {
+            const size_type w = bit / word_bits;
+            return w < words.size() && ( ( words[w] >> ( bit % word_bits ) ) & 1 ) != 0;
+        }
+        /** First set bit at or after @p bit, or npos */
+        size_type next_bit( size_type bit ) const;
+        /** Drops trailing empty words, so equal sets have equal storage */
+        void trim();
+
+        std::vector<word_type> words;
+};
+
+inline flag_set::const_iterator::reference flag_set::const_iterator::operator*() const
+{
+    return flag_set::flag_at( bit );
+}
+
+#endif // CATA_SRC_FLAG_SET_H
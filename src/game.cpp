@@ -196,6 +196,9 @@ class computer;
 static constexpr int DANGEROUS_PROXIMITY = 5;
 
 static const activity_id ACT_OPERATION( "ACT_OPERATION" );
+static const activity_id ACT_WAIT( "ACT_WAIT" );
+static const activity_id ACT_WAIT_STAMINA( "ACT_WAIT_STAMINA" );
+static const activity_id ACT_WAIT_WEATHER( "ACT_WAIT_WEATHER" );
 
 static const mtype_id mon_manhack( "mon_manhack" );
 
@@ -1432,6 +1435,20 @@ void game::calc_driving_offset( vehicle *veh )
     set_driving_view_offset( point( offset.x, offset.y ) );
 }
 
+// Whether every body part has reached the temperature it converges to without getting cold,
+// hot or frostbitten, so that updating it again only changes anything once the weather does
+static bool has_settled_bodytemp( const Character &you )
+{
+    for( const bodypart_id &bp : you.get_all_body_parts() ) {
+        const int temp = you.get_part_temp_cur( bp );
+        if( temp != you.get_part_temp_conv( bp ) || temp < BODYTEMP_COLD || temp > BODYTEMP_HOT ||
+            you.get_part_frostbite_timer( bp ) > 0 ) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // MAIN GAME LOOP
 // Returns true if game is over (death, saved, quit, etc)
 bool game::do_turn()
@@ -1443,13 +1460,20 @@ bool game::do_turn()
     if( new_game ) {
         new_game = false;
     } else {
-        gamemode->per_turn();
+        if( gamemode ) {
+            gamemode->per_turn();
+        }
         calendar::turn += 1_turns;
     }
 
     // starting a new turn, clear out temperature cache
     weather.temperature_cache.clear();
 
+    // While nothing can interrupt the avatar's sleep or wait, the world around them is only
+    // simulated every minute
+    const bool fast_forward = can_fast_forward();
+    const bool world_turn = !fast_forward || calendar::once_every( 1_minutes );
+
     if( npcs_dirty ) {
         load_npcs();
     }
@@ -1481,11 +1505,25 @@ bool game::do_turn()
 
     debug_hour_timer.print_time();
 
-    u.update_body();
+    if( fast_forward && !fast_forward_body_updated ) {
+        fast_forward_body_updated = calendar::turn - 1_turns;
+    }
+    if( !fast_forward_body_updated ) {
+        u.update_body();
+    } else if( world_turn ) {
+        // Catch up on the turns since the body was last updated all at once
+        u.update_body( *fast_forward_body_updated, calendar::turn );
+        fast_forward_body_updated = calendar::turn;
+        if( !fast_forward ) {
+            fast_forward_body_updated.reset();
+        }
+    }
 
     // Auto-save if autosave is enabled
-    if( get_option<bool>( "AUTOSAVE" ) &&
-        calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
+    static const option_handle<bool> autosave_enabled( "AUTOSAVE" );
+    static const option_handle<int> autosave_turns( "AUTOSAVE_TURNS" );
+    if( autosave_enabled.get() &&
+        calendar::once_every( 1_turns * autosave_turns.get() ) &&
         !u.is_dead_state() ) {
         autosave();
     }
@@ -1585,30 +1623,32 @@ bool game::do_turn()
         calc_driving_offset( veh );
     }
 
-    // No-scent debug mutation has to be processed here or else it takes time to start working
-    if( !u.has_flag( STATIC( json_character_flag( "NO_SCENT" ) ) ) ) {
-        scent.set( u.pos(), u.scent, u.get_type_of_scent() );
-        overmap_buffer.set_scent( u.global_omt_location(),  u.scent );
-    }
-    scent.update( u.pos(), m );
-
-    // We need floor cache before checking falling 'n stuff
-    m.build_floor_caches();
-
-    m.process_falling();
-    m.vehmove();
-    m.process_fields();
-    m.process_items();
-    explosion_handler::process_explosions();
-    m.creature_in_field( u );
-
-    // Apply sounds from previous turn to monster and NPC AI.
-    sounds::process_sounds();
     const int levz = m.get_abs_sub().z;
-    // Update vision caches for monsters. If this turns out to be expensive,
-    // consider a stripped down cache just for monsters.
-    m.build_map_cache( levz, true );
-    monmove();
+    if( world_turn ) {
+        // No-scent debug mutation has to be processed here or else it takes time to start working
+        if( !u.has_flag( STATIC( json_character_flag( "NO_SCENT" ) ) ) ) {
+            scent.set( u.pos(), u.scent, u.get_type_of_scent() );
+            overmap_buffer.set_scent( u.global_omt_location(),  u.scent );
+        }
+        scent.update( u.pos(), m );
+
+        // We need floor cache before checking falling 'n stuff
+        m.build_floor_caches();
+
+        m.process_falling();
+        m.vehmove();
+        m.process_fields();
+        m.process_items();
+        explosion_handler::process_explosions();
+        m.creature_in_field( u );
+
+        // Apply sounds from previous turn to monster and NPC AI.
+        sounds::process_sounds();
+        // Update vision caches for monsters. If this turns out to be expensive,
+        // consider a stripped down cache just for monsters.
+        m.build_map_cache( levz, true );
+        monmove();
+    }
     if( calendar::once_every( 5_minutes ) ) {
         overmap_npc_move();
     }
@@ -1626,10 +1666,13 @@ bool game::do_turn()
             }
         }
     }
-    update_stair_monsters();
-    mon_info_update();
+    if( world_turn ) {
+        update_stair_monsters();
+        mon_info_update();
+    }
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    static const option_handle<bool> force_redraw( "FORCE_REDRAW" );
+    if( u.moves < 0 && force_redraw.get() ) {
         ui_manager::redraw();
         refresh_display();
     }
@@ -1674,8 +1717,15 @@ bool game::do_turn()
         wait_popup.reset();
         first_redraw_since_waiting_started = true;
     }
+    if( wait_redraw && calendar::once_every( 1_minutes ) ) {
+        // Nobody notices the pause of generating an overmap while waiting, so prepare the
+        // overmap the player is heading towards before they cross into it
+        overmap_buffer.pregenerate_adjacent( u.global_omt_location(), OMAPX / 6 );
+    }
 
-    u.update_bodytemp();
+    if( world_turn || !has_settled_bodytemp( u ) ) {
+        u.update_bodytemp();
+    }
     u.update_body_wetness( *weather.weather_precise );
     u.apply_wetness_morale( weather.temperature );
 
@@ -4134,6 +4184,34 @@ Creature *game::is_hostile_within( int distance, bool dangerous )
     return nullptr;
 }
 
+bool game::can_fast_forward()
+{
+    if( uquit == QUIT_WATCH || u.is_dead_state() ) {
+        return false;
+    }
+    if( !u.has_effect( effect_sleep ) && !u.has_activity( ACT_WAIT ) &&
+        !u.has_activity( ACT_WAIT_WEATHER ) && !u.has_activity( ACT_WAIT_STAMINA ) ) {
+        return false;
+    }
+    // Vehicles and mounts move every turn
+    if( u.in_vehicle || u.is_mounted() || u.is_underwater() || m.dangerous_field_at( u.pos() ) ) {
+        return false;
+    }
+    // Anything hostile in the reality bubble could come close between two world turns
+    for( monster &critter : all_monsters() ) {
+        if( critter.attitude_to( u ) == Creature::Attitude::HOSTILE ) {
+            return false;
+        }
+    }
+    // NPCs that are awake act every turn
+    for( npc &guy : all_npcs() ) {
+        if( !guy.in_sleep_state() || guy.attitude_to( u ) == Creature::Attitude::HOSTILE ) {
+            return false;
+        }
+    }
+    return true;
+}
+
 std::unordered_set<tripoint> game::get_fishable_locations( int distance, const tripoint &fish_pos )
 {
     // We're going to get the contiguous fishable terrain starting at
@@ -4366,8 +4444,12 @@ void game::mon_info( const catacurses::window &w, int hor_padding )
 
 void game::mon_info_update( )
 {
+    static const option_handle<int> safemode_proximity( "SAFEMODEPROXIMITY" );
+    static const option_handle<int> safemode_ignore_turns( "SAFEMODEIGNORETURNS" );
+    static const option_handle<bool> autosafemode( "AUTOSAFEMODE" );
+    static const option_handle<int> autosafemode_turns( "AUTOSAFEMODETURNS" );
     int newseen = 0;
-    const int safe_proxy_dist = get_option<int>( "SAFEMODEPROXIMITY" );
+    const int safe_proxy_dist = safemode_proximity.get();
     const int iProxyDist = ( safe_proxy_dist <= 0 ) ? MAX_VIEW_DISTANCE :
                            safe_proxy_dist;
 
@@ -4393,7 +4475,7 @@ void game::mon_info_update( )
 
     static time_point previous_turn = calendar::turn_zero;
     const time_duration sm_ignored_turns =
-        time_duration::from_turns( get_option<int>( "SAFEMODEIGNORETURNS" ) );
+        time_duration::from_turns( safemode_ignore_turns.get() );
 
     for( Creature *c : u.get_visible_creatures( MAPSIZE_X ) ) {
         monster *m = dynamic_cast<monster *>( c );
@@ -4555,11 +4637,11 @@ void game::mon_info_update( )
         if( safe_mode == SAFE_MODE_ON ) {
             set_safe_mode( SAFE_MODE_STOP );
         }
-    } else if( calendar::turn > previous_turn && get_option<bool>( "AUTOSAFEMODE" ) &&
+    } else if( calendar::turn > previous_turn && autosafemode.get() &&
                newseen == 0 ) { // Auto-safe mode, but only if it's a new turn
         turnssincelastmon += calendar::turn - previous_turn;
         time_duration auto_safe_mode =
-            time_duration::from_turns( get_option<int>( "AUTOSAFEMODETURNS" ) );
+            time_duration::from_turns( autosafemode_turns.get() );
         if( turnssincelastmon >= auto_safe_mode && safe_mode == SAFE_MODE_OFF ) {
             set_safe_mode( SAFE_MODE_ON );
             add_msg( m_info, _( "Safe mode ON!" ) );
@@ -10141,7 +10223,8 @@ point game::place_player( const tripoint &dest_loc )
     // adjusted_pos = ( old_pos.x - submap_shift.x * SEEX, old_pos.y - submap_shift.y * SEEY, old_pos.z )
 
     //Auto pulp or butcher and Auto foraging
-    if( get_option<bool>( "AUTO_FEATURES" ) && mostseen == 0  && !u.is_mounted() ) {
+    static const option_handle<bool> auto_features( "AUTO_FEATURES" );
+    if( auto_features.get() && mostseen == 0  && !u.is_mounted() ) {
         static const direction adjacentDir[8] = { direction::NORTH, direction::NORTHEAST, direction::EAST, direction::SOUTHEAST, direction::SOUTH, direction::SOUTHWEST, direction::WEST, direction::NORTHWEST };
 
         const std::string forage_type = get_option<std::string>( "AUTO_FORAGING" );
@@ -10221,9 +10304,12 @@ point game::place_player( const tripoint &dest_loc )
     }
 
     //Autopickup
-    if( !u.is_mounted() && get_option<bool>( "AUTO_PICKUP" ) && !u.is_hauling() &&
-        ( !get_option<bool>( "AUTO_PICKUP_SAFEMODE" ) || mostseen == 0 ) &&
-        ( m.has_items( u.pos() ) || get_option<bool>( "AUTO_PICKUP_ADJACENT" ) ) ) {
+    static const option_handle<bool> auto_pickup( "AUTO_PICKUP" );
+    static const option_handle<bool> auto_pickup_safemode( "AUTO_PICKUP_SAFEMODE" );
+    static const option_handle<bool> auto_pickup_adjacent( "AUTO_PICKUP_ADJACENT" );
+    if( !u.is_mounted() && auto_pickup.get() && !u.is_hauling() &&
+        ( !auto_pickup_safemode.get() || mostseen == 0 ) &&
+        ( m.has_items( u.pos() ) || auto_pickup_adjacent.get() ) ) {
         Pickup::pick_up( u.pos(), -1 );
     }
 
@@ -11711,6 +11797,10 @@ point game::update_map( int &x, int &y )
     // Update what parts of the world map we can see
     update_overmap_seen();
 
+    // Generate the overmap the player is heading into while there is still some way to go,
+    // instead of together with the submaps when the map shifts across its border
+    overmap_buffer.pregenerate_adjacent( u.global_omt_location(), OMAPX / 6, shift );
+
     return shift;
 }
 
@@ -12020,7 +12110,8 @@ void game::perhaps_add_random_npc()
     }
     // Create a new NPC?
 
-    double spawn_time = get_option<float>( "NPC_SPAWNTIME" );
+    static const option_handle<float> npc_spawntime( "NPC_SPAWNTIME" );
+    double spawn_time = npc_spawntime.get();
     if( spawn_time == 0.0 ) {
         return;
     }
@@ -12093,6 +12184,11 @@ bool game::display_overlay_state( const action_id action )
     return displaying_overlays && *displaying_overlays == action;
 }
 
+bool game::display_any_overlay() const
+{
+    return displaying_overlays.has_value();
+}
+
 void game::display_toggle_overlay( const action_id action )
 {
     if( display_overlay_state( action ) ) {
@@ -225,6 +225,12 @@ class game
         void start_calendar();
         /** MAIN GAME LOOP. Returns true if game is over (death, saved, quit, etc.). */
         bool do_turn();
+        /**
+         * Whether the coming turns can be fast-forwarded: the avatar sleeps or waits, and
+         * nothing that could interrupt them is around. The world is then only simulated every
+         * minute, while the avatar still lives through every turn, see do_turn.
+         */
+        bool can_fast_forward();
         shared_ptr_fast<ui_adaptor> create_or_get_main_ui_adaptor();
         void invalidate_main_ui_adaptor() const;
         void mark_main_ui_adaptor_resize() const;
@@ -1031,6 +1037,8 @@ class game
         void display_toggle_overlay( action_id );
         // Get the state of an overlay (on/off).
         bool display_overlay_state( action_id );
+        // Whether any overlay is on.
+        bool display_any_overlay() const;
         // toggles the timing of in-game hours
         void toggle_debug_hour_timer();
         /** Creature for which to display the visibility map */
@@ -1086,6 +1094,8 @@ class game
         bool critter_died = false;
         /** Is this the first redraw since waiting (sleeping or activity) started */
         bool first_redraw_since_waiting_started = true;
+        /** While the turns are fast-forwarded, the turn the avatar's body was last updated */
+        cata::optional<time_point> fast_forward_body_updated;
         /** Is Zone manager open or not - changes graphics of some zone tiles */
         bool zones_manager_open = false;
 
@@ -31,6 +31,7 @@
 #include "proficiency.h"
 #include "ret_val.h"
 #include "rng.h"
+#include "temp_crafting_inventory.h"
 #include "translations.h"
 #include "type_id.h"
 #include "units.h"
@@ -458,7 +459,7 @@ void inventory::form_from_zone( map &m, std::unordered_set<tripoint> &zone_pts,
 
 void inventory::form_from_map( map &m, const tripoint &origin, int range, const Character *pl,
                                bool assign_invlet,
-                               bool clear_path )
+                               bool clear_path, temp_crafting_inventory *refs )
 {
     // populate a grid of spots that can be reached
     std::vector<tripoint> reachable_pts = {};
@@ -472,11 +473,11 @@ void inventory::form_from_map( map &m, const tripoint &origin, int range, const
             reachable_pts.emplace_back( p );
         }
     }
-    form_from_map( m, reachable_pts, pl, assign_invlet );
+    form_from_map( m, reachable_pts, pl, assign_invlet, refs );
 }
 
 void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Character *pl,
-                               bool assign_invlet )
+                               bool assign_invlet, temp_crafting_inventory *refs )
 {
     items.clear();
     provisioned_pseudo_tools.clear();
@@ -502,7 +503,12 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                 if( pl && !i.is_owned_by( *pl, true ) ) {
                     continue;
                 }
-                if( !i.made_of( phase_id::LIQUID ) ) {
+                if( i.made_of( phase_id::LIQUID ) ) {
+                    continue;
+                }
+                if( refs ) {
+                    refs->add_item_ref( i );
+                } else {
                     add_item( i, false, assign_invlet );
                 }
             }
@@ -531,7 +537,11 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                 }
             }
             if( water != toilet.end() && water->charges > 0 ) {
-                add_item( *water );
+                if( refs ) {
+                    refs->add_item_ref( *water );
+                } else {
+                    add_item( *water );
+                }
             }
         }
 
@@ -539,7 +549,12 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
         if( m.furn( p )->has_examine( iexamine::keg ) ) {
             map_stack liq_contained = m.i_at( p );
             for( auto &i : liq_contained ) {
-                if( i.made_of( phase_id::LIQUID ) ) {
+                if( !i.made_of( phase_id::LIQUID ) ) {
+                    continue;
+                }
+                if( refs ) {
+                    refs->add_item_ref( i );
+                } else {
                     add_item( i );
                 }
             }
@@ -547,7 +562,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
 
         // form from vehicle
         if( optional_vpart_position vp = m.veh_at( p ) ) {
-            vp->form_inventory( *this );
+            vp->form_inventory( *this, refs );
         }
     }
     pts.clear();
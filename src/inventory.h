@@ -31,6 +31,7 @@ class JsonOut;
 class item_stack;
 class map;
 class npc;
+class temp_crafting_inventory;
 struct tripoint;
 
 using invstack = std::list<std::list<item> >;
@@ -136,11 +137,16 @@ class inventory : public visitable
         void form_from_map( const tripoint &origin, int range, const Character *pl = nullptr,
                             bool assign_invlet = true,
                             bool clear_path = true );
+        /**
+         * @param refs if not null, real items found on the map and in vehicle cargo are added to
+         * it as references instead of being copied into this inventory. Only pseudo items
+         * (furniture and vehicle tools, fire, water from infinite sources) are created here.
+         */
         void form_from_map( map &m, const tripoint &origin, int range, const Character *pl = nullptr,
                             bool assign_invlet = true,
-                            bool clear_path = true );
+                            bool clear_path = true, temp_crafting_inventory *refs = nullptr );
         void form_from_map( map &m, std::vector<tripoint> pts, const Character *pl,
-                            bool assign_invlet = true );
+                            bool assign_invlet = true, temp_crafting_inventory *refs = nullptr );
         /**
          * Remove a specific item from the inventory. The item is compared
          * by pointer. Contents of the item are removed as well.
@@ -50,6 +50,7 @@
 #include "game.h"
 #include "game_constants.h"
 #include "gun_mode.h"
+#include "hash_utils.h"
 #include "iexamine.h"
 #include "inventory.h"
 #include "item_category.h"
@@ -1078,8 +1079,15 @@ bool item::stacks_with( const item &rhs, bool check_components, bool combine_liq
     if( combine_liquid && has_temperature() && made_of_from_type( phase_id::LIQUID ) ) {
 
         //we can combine liquids of same type and different temperatures
-        if( !equal_ignoring_elements( rhs.get_flags(), get_flags(),
-        { flag_COLD, flag_FROZEN, flag_HOT } ) ) {
+        FlagsSetType own_flags = get_flags();
+        FlagsSetType rhs_flags = rhs.get_flags();
+        for( const flag_id &f : {
+                 flag_COLD, flag_FROZEN, flag_HOT
+             } ) {
+            own_flags.erase( f );
+            rhs_flags.erase( f );
+        }
+        if( own_flags != rhs_flags ) {
             return false;
         }
     } else if( item_tags != rhs.item_tags ) {
@@ -1098,8 +1106,8 @@ bool item::stacks_with( const item &rhs, bool check_components, bool combine_liq
     }
     // Guns that differ only by dirt/shot_counter can still stack,
     // but other item_vars such as label/note will prevent stacking
-    const std::vector<std::string> ignore_keys = { "dirt", "shot_counter" };
-    if( map_without_keys( item_vars, ignore_keys ) != map_without_keys( rhs.item_vars, ignore_keys ) ) {
+    static const std::vector<std::string> ignore_keys = { "dirt", "shot_counter" };
+    if( !item_vars.equal_ignoring( rhs.item_vars, ignore_keys ) ) {
         return false;
     }
     if( goes_bad() && rhs.goes_bad() ) {
@@ -1184,32 +1192,27 @@ ret_val<bool> item::put_in( const item &payload, item_pocket::pocket_type pk_typ
 
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, static_cast<long long>( value ) );
+    revision = new_revision();
 }
 
 void item::set_var( const std::string &name, const long long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, value );
+    revision = new_revision();
 }
 
 // NOLINTNEXTLINE(cata-no-long)
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, static_cast<long long>( value ) );
+    revision = new_revision();
 }
 
 void item::set_var( const std::string &name, const double value )
 {
-    item_vars[name] = string_format( "%f", value );
+    item_vars.set( name, value );
+    revision = new_revision();
 }
 
 double item::get_var( const std::string &name, const double default_value ) const
@@ -1218,7 +1221,10 @@ double item::get_var( const std::string &name, const double default_value ) cons
     if( it == item_vars.end() ) {
         return default_value;
     }
-    const std::string &val = it->second;
+    if( it->is_number() ) {
+        return it->number();
+    }
+    const std::string val = it->str();
     char *end;
     errno = 0;
     double result = strtod( &val[0], &end );
@@ -1235,7 +1241,8 @@ double item::get_var( const std::string &name, const double default_value ) cons
 
 void item::set_var( const std::string &name, const tripoint &value )
 {
-    item_vars[name] = string_format( "%d,%d,%d", value.x, value.y, value.z );
+    item_vars.set( name, string_format( "%d,%d,%d", value.x, value.y, value.z ) );
+    revision = new_revision();
 }
 
 tripoint item::get_var( const std::string &name, const tripoint &default_value ) const
@@ -1244,7 +1251,7 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
     if( it == item_vars.end() ) {
         return default_value;
     }
-    std::vector<std::string> values = string_split( it->second, ',' );
+    std::vector<std::string> values = string_split( it->str(), ',' );
     cata_assert( values.size() == 3 );
     auto convert_or_error = []( const std::string & s ) {
         ret_val<int> result = try_parse_integer<int>( s, false );
@@ -1262,7 +1269,8 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
 
 void item::set_var( const std::string &name, const std::string &value )
 {
-    item_vars[name] = value;
+    item_vars.set( name, value );
+    revision = new_revision();
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
@@ -1271,7 +1279,7 @@ std::string item::get_var( const std::string &name, const std::string &default_v
     if( it == item_vars.end() ) {
         return default_value;
     }
-    return it->second;
+    return it->str();
 }
 
 std::string item::get_var( const std::string &name ) const
@@ -1287,11 +1295,13 @@ bool item::has_var( const std::string &name ) const
 void item::erase_var( const std::string &name )
 {
     item_vars.erase( name );
+    revision = new_revision();
 }
 
 void item::clear_vars()
 {
     item_vars.clear();
+    revision = new_revision();
 }
 
 // TODO: Get rid of, handle multiple types gracefully
@@ -1741,14 +1751,13 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
 
     if( parts->test( iteminfo_parts::DESCRIPTION ) ) {
         insert_separation_line( info );
-        const std::map<std::string, std::string>::const_iterator idescription =
-            item_vars.find( "description" );
+        const item_var_map::const_iterator idescription = item_vars.find( "description" );
         const cata::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
             info.emplace_back( "DESCRIPTION", snippet.value().translated() );
         } else if( idescription != item_vars.end() ) {
-            info.emplace_back( "DESCRIPTION", idescription->second );
+            info.emplace_back( "DESCRIPTION", idescription->str() );
         } else if( has_gun_variant() ) {
             info.emplace_back( "DESCRIPTION", gun_variant().alt_description.translated() );
         } else {
@@ -1837,10 +1846,10 @@ void item::debug_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
             }, enumeration_conjunction::none );
 
             info.emplace_back( "BASE", string_format( _( "tags: %s" ), tags_listed ) );
-            for( auto const &imap : item_vars ) {
+            for( const item_var_map::entry &imap : item_vars ) {
                 info.emplace_back( "BASE",
-                                   string_format( _( "item var: %s, %s" ), imap.first,
-                                                  imap.second ) );
+                                   string_format( _( "item var: %s, %s" ), imap.key(),
+                                                  imap.str() ) );
             }
 
             const std::string space = "  ";
@@ -4005,10 +4014,8 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
     avatar &player_character = get_avatar();
     if( parts->test( iteminfo_parts::DESCRIPTION_FLAGS ) ) {
         // concatenate base and acquired flags...
-        std::vector<flag_id> flags;
-        std::set_union( type->get_flags().begin(), type->get_flags().end(),
-                        get_flags().begin(), get_flags().end(),
-                        std::back_inserter( flags ) );
+        FlagsSetType flags = type->get_flags();
+        flags.insert( get_flags().begin(), get_flags().end() );
 
         // ...and display those which have an info description
         for( const flag_id &e : sorted_lex( flags ) ) {
@@ -4156,27 +4163,26 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         }
     }
 
-    std::map<std::string, std::string>::const_iterator item_note = item_vars.find( "item_note" );
+    const item_var_map::const_iterator item_note = item_vars.find( "item_note" );
 
     if( item_note != item_vars.end() && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
         insert_separation_line( info );
         std::string ntext;
-        std::map<std::string, std::string>::const_iterator item_note_tool =
-            item_vars.find( "item_note_tool" );
+        const item_var_map::const_iterator item_note_tool = item_vars.find( "item_note_tool" );
         const use_function *use_func =
             item_note_tool != item_vars.end() ?
             item_controller->find_template(
-                itype_id( item_note_tool->second ) )->get_use( "inscribe" ) :
+                itype_id( item_note_tool->str() ) )->get_use( "inscribe" ) :
             nullptr;
         const inscribe_actor *use_actor =
             use_func ? dynamic_cast<const inscribe_actor *>( use_func->get_actor_ptr() ) : nullptr;
         if( use_actor ) {
             //~ %1$s: gerund (e.g. carved), %2$s: item name, %3$s: inscription text
             ntext = string_format( pgettext( "carving", "%1$s on the %2$s is: %3$s" ),
-                                   use_actor->gerund, tname(), item_note->second );
+                                   use_actor->gerund, tname(), item_note->str() );
         } else {
             //~ %1$s: inscription text
-            ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note->second );
+            ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note->str() );
         }
         info.emplace_back( "DESCRIPTION", ntext );
     }
@@ -5215,8 +5221,46 @@ int item::price( bool practical ) const
     return res;
 }
 
-// TODO: MATERIALS add a density field to materials.json
+uint64_t item::new_revision()
+{
+    static uint64_t last_revision = 0;
+    return ++last_revision;
+}
+
+size_t item::state_hash() const
+{
+    size_t seed = revision;
+    cata::hash_combine( seed, type );
+    cata::hash_combine( seed, charges );
+    cata::hash_combine( seed, corpse );
+    cata::hash_combine( seed, static_cast<int>( current_phase ) );
+    cata::hash_combine( seed, contents.state_hash() );
+    return seed;
+}
+
+void item::validate_cached_properties() const
+{
+    const size_t state = state_hash();
+    if( state != cached_properties.state ) {
+        cached_properties = derived_properties();
+        cached_properties.state = state;
+    }
+}
+
 units::mass item::weight( bool include_contents, bool integral ) const
+{
+    if( !include_contents || integral ) {
+        return calc_weight( include_contents, integral );
+    }
+    validate_cached_properties();
+    if( !cached_properties.weight ) {
+        cached_properties.weight = calc_weight( true, false );
+    }
+    return *cached_properties.weight;
+}
+
+// TODO: MATERIALS add a density field to materials.json
+units::mass item::calc_weight( bool include_contents, bool integral ) const
 {
     if( is_null() ) {
         return 0_gram;
@@ -5430,6 +5474,18 @@ units::volume item::base_volume() const
 }
 
 units::volume item::volume( bool integral, bool ignore_contents ) const
+{
+    if( integral || ignore_contents ) {
+        return calc_volume( integral, ignore_contents );
+    }
+    validate_cached_properties();
+    if( !cached_properties.volume ) {
+        cached_properties.volume = calc_volume( false, false );
+    }
+    return *cached_properties.volume;
+}
+
+units::volume item::calc_volume( bool integral, bool ignore_contents ) const
 {
     if( is_null() ) {
         return 0_ml;
@@ -5620,7 +5676,10 @@ int item::current_reach_range( const Character &guy ) const
 
 void item::unset_flags()
 {
-    item_tags.clear();
+    if( !item_tags.empty() ) {
+        item_tags.clear();
+        revision = new_revision();
+    }
     requires_tags_processing = true;
 }
 
@@ -5675,7 +5734,9 @@ bool item::has_flag( const flag_id &f ) const
 item &item::set_flag( const flag_id &flag )
 {
     if( flag.is_valid() ) {
-        item_tags.insert( flag );
+        if( item_tags.insert( flag ).second ) {
+            revision = new_revision();
+        }
         requires_tags_processing = true;
     } else {
         debugmsg( "Attempted to set invalid flag_id %s", flag.str() );
@@ -5685,7 +5746,9 @@ item &item::set_flag( const flag_id &flag )
 
 item &item::unset_flag( const flag_id &flag )
 {
-    item_tags.erase( flag );
+    if( item_tags.erase( flag ) > 0 ) {
+        revision = new_revision();
+    }
     requires_tags_processing = true;
     return *this;
 }
@@ -9013,6 +9076,8 @@ void item::set_item_specific_energy( const float new_specific_energy )
     // Warm = over temperatures::warm
     // Cold = below temperatures::cold
     // Frozen = Over 50% frozen
+    const int old_temperature_flags = own_temperature_flags();
+    const uint64_t old_revision = revision;
     if( has_own_flag( flag_FROZEN ) ) {
         unset_flag( flag_FROZEN );
         if( freeze_percentage < 0.5 ) {
@@ -9037,6 +9102,10 @@ void item::set_item_specific_energy( const float new_specific_energy )
     } else if( new_item_temperature < temp_to_kelvin( temperatures::cold ) ) {
         set_flag( flag_COLD );
     }
+    // the flags are taken off and put back on at every update, which is not a change
+    if( own_temperature_flags() == old_temperature_flags ) {
+        revision = old_revision;
+    }
     temperature = std::lround( 100000 * new_item_temperature );
     specific_energy = std::lround( 100000 * new_specific_energy );
     reset_temp_check();
@@ -9088,6 +9157,8 @@ void item::set_item_temperature( float new_temperature )
         freeze_percentage = ( completely_liquid_specific_energy - new_specific_energy ) /
                             ( completely_liquid_specific_energy - completely_frozen_specific_energy );
     }
+    const int old_temperature_flags = own_temperature_flags();
+    const uint64_t old_revision = revision;
     if( has_own_flag( flag_FROZEN ) ) {
         unset_flag( flag_FROZEN );
         if( freeze_percentage < 0.5 ) {
@@ -9112,6 +9183,10 @@ void item::set_item_temperature( float new_temperature )
     } else if( new_temperature < temp_to_kelvin( temperatures::cold ) ) {
         set_flag( flag_COLD );
     }
+    // the flags are taken off and put back on at every update, which is not a change
+    if( own_temperature_flags() == old_temperature_flags ) {
+        revision = old_revision;
+    }
     reset_temp_check();
 }
 
@@ -9437,18 +9512,19 @@ bool item::already_used_by_player( const Character &p ) const
     // ';<id>;' matches at most one part of USED_BY_IDS, and only when exactly that
     // id has been added.
     const std::string needle = string_format( ";%d;", p.getID().get_value() );
-    return it->second.find( needle ) != std::string::npos;
+    return it->str().find( needle ) != std::string::npos;
 }
 
 void item::mark_as_used_by_player( const player &p )
 {
-    std::string &used_by_ids = item_vars[ USED_BY_IDS ];
+    std::string used_by_ids = get_var( USED_BY_IDS );
     if( used_by_ids.empty() ) {
         // *always* start with a ';'
         used_by_ids = ";";
     }
     // and always end with a ';'
     used_by_ids += string_format( "%d;", p.getID().get_value() );
+    set_var( USED_BY_IDS, used_by_ids );
 }
 
 bool item::can_holster( const item &obj, bool ) const
@@ -9831,6 +9907,8 @@ void item::calc_temp( const int temp, const float insulation, const time_duratio
     // Warm = over temperatures::warm
     // Cold = below temperatures::cold
     // Frozen = Over 50% frozen
+    const int old_temperature_flags = own_temperature_flags();
+    const uint64_t old_revision = revision;
     if( has_own_flag( flag_FROZEN ) ) {
         unset_flag( flag_FROZEN );
         if( freeze_percentage < 0.5 ) {
@@ -9857,6 +9935,10 @@ void item::calc_temp( const int temp, const float insulation, const time_duratio
     } else if( new_item_temperature < temp_to_kelvin( temperatures::cold ) ) {
         set_flag( flag_COLD );
     }
+    // the flags are taken off and put back on at every update, which is not a change
+    if( own_temperature_flags() == old_temperature_flags ) {
+        revision = old_revision;
+    }
     temperature = std::lround( 100000 * new_item_temperature );
     specific_energy = std::lround( 100000 * new_specific_energy );
 
@@ -9868,6 +9950,12 @@ float item::get_item_thermal_energy() const
     return 0.00001 * specific_energy * mass;
 }
 
+int item::own_temperature_flags() const
+{
+    return ( has_own_flag( flag_HOT ) ? 1 : 0 ) | ( has_own_flag( flag_COLD ) ? 2 : 0 ) |
+           ( has_own_flag( flag_FROZEN ) ? 4 : 0 ) | ( has_own_flag( flag_NO_PARASITES ) ? 8 : 0 );
+}
+
 void item::heat_up()
 {
     unset_flag( flag_COLD );
@@ -10606,7 +10694,7 @@ std::string item::type_name( unsigned int quantity ) const
                                   corpse->nname() );
         }
     } else if( iter != item_vars.end() ) {
-        return iter->second;
+        return iter->str();
     } else if( has_gun_variant() ) {
         ret_name = gun_variant().brand_name.translated();
     } else {
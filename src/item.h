@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iosfwd>
@@ -20,11 +21,13 @@
 #include "compatibility.h"
 #include "craft_command.h"
 #include "enums.h"
+#include "flag_set.h"
 #include "gun_mode.h"
 #include "io_tags.h"
 #include "item_contents.h"
 #include "item_location.h"
 #include "item_pocket.h"
+#include "item_var_map.h"
 #include "material.h"
 #include "optional.h"
 #include "requirements.h"
@@ -177,7 +180,7 @@ inline bool is_crafting_component( const item &component );
 class item : public visitable
 {
     public:
-        using FlagsSetType = std::set<flag_id>;
+        using FlagsSetType = flag_set;
 
         item();
 
@@ -585,6 +588,13 @@ class item : public visitable
          */
         units::volume volume( bool integral = false, bool ignore_contents = false ) const;
 
+        /**
+         * Hash of everything @ref weight and @ref volume depend on, including
+         * all contained items. Changes to a nested item change the hash of every
+         * item containing it, so their memoized values never need explicit invalidation.
+         */
+        size_t state_hash() const;
+
         units::length length() const;
 
         /**
@@ -2351,7 +2361,7 @@ class item : public visitable
         FlagsSetType item_tags; // generic item specific flags
         safe_reference_anchor anchor;
         const itype *curammo = nullptr;
-        std::map<std::string, std::string> item_vars;
+        item_var_map item_vars;
         const mtype *corpse = nullptr;
         std::string corpse_name;       // Name of the late lamented
         std::set<matec_id> techniques; // item specific techniques
@@ -2437,6 +2447,29 @@ class item : public visitable
         light_emission light = nolight;
         mutable cata::optional<float> cached_relative_encumbrance;
 
+        /**
+         * Replaced with a @ref new_revision whenever item vars or item specific flags change.
+         * Together with the fields that are modified directly (type, charges, ...) and the
+         * contents it makes up @ref state_hash. Revisions are never reused, so two items only
+         * share one if one is an unchanged copy of the other.
+         */
+        uint64_t revision = new_revision();
+        static uint64_t new_revision();
+        /** Bit mask of the temperature flags the item has itself, see @ref revision */
+        int own_temperature_flags() const;
+        /** Results of @ref weight and @ref volume with default arguments */
+        struct derived_properties {
+            size_t state = 0;
+            cata::optional<units::mass> weight;
+            cata::optional<units::volume> volume;
+        };
+        mutable derived_properties cached_properties;
+
+        /** Drops @ref cached_properties if this item or its contents changed since they were computed. */
+        void validate_cached_properties() const;
+        units::mass calc_weight( bool include_contents, bool integral ) const;
+        units::volume calc_volume( bool integral, bool ignore_contents ) const;
+
     public:
         char invlet = 0;      // Inventory letter
         bool active = false; // If true, it has active effects to be processed
@@ -13,6 +13,7 @@
 #include "enum_conversions.h"
 #include "enums.h"
 #include "flat_set.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "inventory.h"
 #include "item.h"
@@ -1506,6 +1507,15 @@ units::volume item_contents::item_size_modifier() const
     return total_vol;
 }
 
+size_t item_contents::state_hash() const
+{
+    size_t seed = 0;
+    for( const item_pocket &pocket : contents ) {
+        cata::hash_combine( seed, pocket.state_hash() );
+    }
+    return seed;
+}
+
 units::mass item_contents::item_weight_modifier() const
 {
     units::mass total_mass = 0_gram;
@@ -111,6 +111,8 @@ class item_contents
 
         units::volume item_size_modifier() const;
         units::mass item_weight_modifier() const;
+        // combined @ref item_pocket::state_hash of all pockets
+        size_t state_hash() const;
 
         // gets the total weight capacity of all pockets
         units::mass total_container_weight_capacity() const;
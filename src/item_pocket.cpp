@@ -16,6 +16,7 @@
 #include "enums.h"
 #include "flag.h"
 #include "generic_factory.h"
+#include "hash_utils.h"
 #include "handle_liquid.h"
 #include "item.h"
 #include "item_category.h"
@@ -491,6 +492,16 @@ units::volume item_pocket::item_size_modifier() const
     return std::max( 0_ml, total_vol );
 }
 
+size_t item_pocket::state_hash() const
+{
+    size_t seed = 0;
+    cata::hash_combine( seed, data );
+    for( const item &it : contents ) {
+        cata::hash_combine( seed, it.state_hash() );
+    }
+    return seed;
+}
+
 units::mass item_pocket::item_weight_modifier() const
 {
     units::mass total_mass = 0_gram;
@@ -178,6 +178,8 @@ class item_pocket
 
         units::volume item_size_modifier() const;
         units::mass item_weight_modifier() const;
+        // hash of the pocket type and the @ref item::state_hash of everything inside it
+        size_t state_hash() const;
 
         /** gets the spoilage multiplier depending on sealed data */
         float spoil_multiplier() const;
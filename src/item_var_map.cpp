@@ -0,0 +1,197 @@
+#include "item_var_map.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <unordered_set>
+
+#include "json.h"
+#include "string_formatter.h"
+
+static const std::string *intern_key( const std::string &key )
+{
+    // elements of an unordered_set don't move, so the pointers stay valid
+    static std::unordered_set<std::string> keys;
+    return &*keys.insert( key ).first;
+}
+
+static std::string format_floating( const double value )
+{
+    // same format as item::set_var used when values were stored as strings
+    return string_format( "%f", value );
+}
+
+// Integers in the form written by std::ostream, without a sign on zero and without leading zeros
+static bool is_canonical_integer( const std::string &s )
+{
+    const size_t start = !s.empty() && s[0] == '-' ? 1 : 0;
+    const size_t digits = s.size() - start;
+    // 18 digits always fit into a long long
+    if( digits == 0 || digits > 18 ) {
+        return false;
+    }
+    if( !std::all_of( s.begin() + start, s.end(), []( const char c ) {
+    return c >= '0' && c <= '9';
+} ) ) {
+        return false;
+    }
+    if( s[start] == '0' ) {
+        return s == "0";
+    }
+    return true;
+}
+
+static bool parse_canonical_floating( const std::string &s, double &result )
+{
+    if( s.find( '.' ) == std::string::npos ) {
+        return false;
+    }
+    char *end;
+    errno = 0;
+    result = strtod( s.c_str(), &end );
+    return errno == 0 && end == s.c_str() + s.size() && format_floating( result ) == s;
+}
+
+std::string item_var_map::entry::str() const
+{
+    switch( kind_ ) {
+        case kind::integer:
+            return std::to_string( integer_ );
+        case kind::floating:
+            return format_floating( floating_ );
+        case kind::text:
+            break;
+    }
+    return text_;
+}
+
+bool item_var_map::entry::operator==( const entry &rhs ) const
+{
+    if( key_ != rhs.key_ || kind_ != rhs.kind_ ) {
+        return false;
+    }
+    switch( kind_ ) {
+        case kind::integer:
+            return integer_ == rhs.integer_;
+        case kind::floating:
+            return floating_ == rhs.floating_;
+        case kind::text:
+            break;
+    }
+    return text_ == rhs.text_;
+}
+
+item_var_map::const_iterator item_var_map::find( const std::string &key ) const
+{
+    const auto iter = std::lower_bound( vars.begin(), vars.end(), key,
+    []( const entry & e, const std::string & k ) {
+        return e.key() < k;
+    } );
+    return iter != vars.end() && iter->key() == key ? iter : vars.end();
+}
+
+item_var_map::entry &item_var_map::get_or_insert( const std::string &key )
+{
+    const auto iter = std::lower_bound( vars.begin(), vars.end(), key,
+    []( const entry & e, const std::string & k ) {
+        return e.key() < k;
+    } );
+    if( iter != vars.end() && iter->key() == key ) {
+        return *iter;
+    }
+    entry e;
+    e.key_ = intern_key( key );
+    return *vars.insert( iter, std::move( e ) );
+}
+
+void item_var_map::set( const std::string &key, const long long value )
+{
+    entry &e = get_or_insert( key );
+    e.kind_ = entry::kind::integer;
+    e.integer_ = value;
+    e.text_.clear();
+}
+
+void item_var_map::set( const std::string &key, const double value )
+{
+    // keep the precision of the saved form, so the value reads the same after a reload
+    set( key, format_floating( value ) );
+}
+
+void item_var_map::set( const std::string &key, const std::string &value )
+{
+    entry &e = get_or_insert( key );
+    double floating = 0.0;
+    if( is_canonical_integer( value ) ) {
+        e.kind_ = entry::kind::integer;
+        e.integer_ = std::stoll( value );
+        e.text_.clear();
+    } else if( parse_canonical_floating( value, floating ) ) {
+        e.kind_ = entry::kind::floating;
+        e.floating_ = floating;
+        e.text_.clear();
+    } else {
+        e.kind_ = entry::kind::text;
+        e.text_ = value;
+    }
+}
+
+item_var_map::const_iterator item_var_map::erase( const_iterator pos )
+{
+    return vars.erase( pos );
+}
+
+size_t item_var_map::erase( const std::string &key )
+{
+    const auto iter = find( key );
+    if( iter == end() ) {
+        return 0;
+    }
+    vars.erase( iter );
+    return 1;
+}
+
+bool item_var_map::equal_ignoring( const item_var_map &rhs,
+                                   const std::vector<std::string> &ignored ) const
+{
+    const auto is_ignored = [&ignored]( const entry & e ) {
+        return std::find( ignored.begin(), ignored.end(), e.key() ) != ignored.end();
+    };
+    const_iterator a = begin();
+    const_iterator b = rhs.begin();
+    while( true ) {
+        while( a != end() && is_ignored( *a ) ) {
+            ++a;
+        }
+        while( b != rhs.end() && is_ignored( *b ) ) {
+            ++b;
+        }
+        if( a == end() || b == rhs.end() ) {
+            return a == end() && b == rhs.end();
+        }
+        if( *a != *b ) {
+            return false;
+        }
+        ++a;
+        ++b;
+    }
+}
+
+void item_var_map::serialize( JsonOut &jsout ) const
+{
+    jsout.start_object();
+    for( const entry &e : vars ) {
+        jsout.member( e.key(), e.str() );
+    }
+    jsout.end_object();
+}
+
+void item_var_map::deserialize( JsonIn &jsin )
+{
+    vars.clear();
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        const std::string key = jsin.get_member_name();
+        set( key, jsin.get_string() );
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+#ifndef CATA_SRC_ITEM_VAR_MAP_H
+#define CATA_SRC_ITEM_VAR_MAP_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class JsonIn;
+class JsonOut;
+
+/**
+ * Storage for the variables of an item (see @ref item::set_var).
+ *
+ * Variables are kept in a small vector sorted by name. Names are interned, so each item
+ * only stores a pointer to them. Values that are integers or doubles in the form written by
+ * `set_var` are stored as numbers and only turned into strings when needed, so they are
+ * saved exactly as before.
+ */
+class item_var_map
+{
+    public:
+        class entry
+        {
+            public:
+                const std::string &key() const {
+                    return *key_;
+                }
+                /** Whether the value is stored as a number */
+                bool is_number() const {
+                    return kind_ != kind::text;
+                }
+                /** Numeric value, only valid if @ref is_number */
+                double number() const {
+                    return kind_ == kind::integer ? static_cast<double>( integer_ ) : floating_;
+                }
+                /** The value as it is saved */
+                std::string str() const;
+
+                bool operator==( const entry &rhs ) const;
+                bool operator!=( const entry &rhs ) const {
+                    return !( *this == rhs );
+                }
+
+            private:
+                friend class item_var_map;
+
+                enum class kind : char {
+                    integer,
+                    floating,
+                    text
+                };
+
+                const std::string *key_ = nullptr;
+                kind kind_ = kind::text;
+                union {
+                    long long integer_ = 0;
+                    double floating_;
+                };
+                std::string text_;
+        };
+        using const_iterator = std::vector<entry>::const_iterator;
+
+        const_iterator begin() const {
+            return vars.begin();
+        }
+        const_iterator end() const {
+            return vars.end();
+        }
+        bool empty() const {
+            return vars.empty();
+        }
+        size_t size() const {
+            return vars.size();
+        }
+        void clear() {
+            vars.clear();
+        }
+
+        const_iterator find( const std::string &key ) const;
+        size_t count( const std::string &key ) const {
+            return find( key ) != end() ? 1 : 0;
+        }
+
+        void set( const std::string &key, long long value );
+        void set( const std::string &key, double value );
+        /** Strings that look exactly like the output of the numeric setters are stored as numbers */
+        void set( const std::string &key, const std::string &value );
+
+        const_iterator erase( const_iterator pos );
+        size_t erase( const std::string &key );
+
+        bool operator==( const item_var_map &rhs ) const {
+            return vars == rhs.vars;
+        }
+        bool operator!=( const item_var_map &rhs ) const {
+            return vars != rhs.vars;
+        }
+        /** Compares both maps while ignoring the given variables */
+        bool equal_ignoring( const item_var_map &rhs, const std::vector<std::string> &ignored ) const;
+
+        /** Written as a JSON object of strings, sorted by name */
+        void serialize( JsonOut &jsout ) const;
+        void deserialize( JsonIn &jsin );
+
+    private:
+        /** The entry for the key, inserted if there is none */
+        entry &get_or_insert( const std::string &key );
+
+        std::vector<entry> vars;
+};
+
+#endif // CATA_SRC_ITEM_VAR_MAP_H
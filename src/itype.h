@@ -18,6 +18,7 @@
 #include "damage.h"
 #include "enums.h" // point
 #include "explosion.h"
+#include "flag_set.h"
 #include "game_constants.h"
 #include "item_pocket.h"
 #include "iuse.h" // use_function
@@ -847,7 +848,7 @@ class islot_milling
 struct itype {
         friend class Item_factory;
 
-        using FlagsSetType = std::set<flag_id>;
+        using FlagsSetType = flag_set;
 
         std::vector<std::pair<itype_id, mod_id>> src;
 
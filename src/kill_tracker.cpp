@@ -15,6 +15,15 @@
 #include "string_formatter.h"
 #include "translations.h"
 
+static constexpr size_t monster_killer =
+    cata::event::field<event_type::character_kills_monster>( "killer" );
+static constexpr size_t monster_victim_type =
+    cata::event::field<event_type::character_kills_monster>( "victim_type" );
+static constexpr size_t character_killer =
+    cata::event::field<event_type::character_kills_character>( "killer" );
+static constexpr size_t character_victim_name =
+    cata::event::field<event_type::character_kills_character>( "victim_name" );
+
 void kill_tracker::reset( const std::map<mtype_id, int> &kills_,
                           const std::vector<std::string> &npc_kills_ )
 {
@@ -120,21 +129,23 @@ void kill_tracker::notify( const cata::event &e )
 {
     switch( e.type() ) {
         case event_type::character_kills_monster: {
-            character_id killer = e.get<character_id>( "killer" );
+            character_id killer = e.get<event_type::character_kills_monster, monster_killer>();
             if( killer != get_player_character().getID() ) {
                 // TODO: add a kill counter for npcs?
                 break;
             }
-            mtype_id victim_type = e.get<mtype_id>( "victim_type" );
+            mtype_id victim_type =
+                e.get<event_type::character_kills_monster, monster_victim_type>();
             kills[victim_type]++;
             break;
         }
         case event_type::character_kills_character: {
-            character_id killer = e.get<character_id>( "killer" );
+            character_id killer = e.get<event_type::character_kills_character, character_killer>();
             if( killer != get_player_character().getID() ) {
                 break;
             }
-            std::string victim_name = e.get<cata_variant_type::string>( "victim_name" );
+            std::string victim_name =
+                e.get<event_type::character_kills_character, character_victim_name>();
             npc_kills.push_back( victim_name );
             break;
         }
@@ -1087,6 +1087,30 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
     }
 }
 
+/**
+ * Shadowcasts the field of view from `origin` on its z-level, the same way as
+ * @ref build_seen_cache does for the player, and stores which tiles it reaches.
+ * Like @ref map::sees, it uses the plain transparency without the player's adjustments.
+ */
+void map::build_los_bitmap( const tripoint &origin, los_bitmap &output ) const
+{
+    const float ( &transparency_cache )[MAPSIZE_X][MAPSIZE_Y] =
+        get_cache_ref( origin.z ).transparency_cache;
+    // Only used as scratch space, too large to be put on the stack.
+    static float seen[MAPSIZE_X][MAPSIZE_Y];
+    std::uninitialized_fill_n( &seen[0][0], MAPSIZE_X * MAPSIZE_Y,
+                               static_cast<float>( LIGHT_TRANSPARENCY_SOLID ) );
+    seen[origin.x][origin.y] = VISIBILITY_FULL;
+    castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+        seen, transparency_cache, origin.xy(), 0 );
+
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            output[x][y] = seen[x][y] > LIGHT_TRANSPARENCY_SOLID;
+        }
+    }
+}
+
 //Schraudolph's algorithm with John's constants
 static inline
 float fastexp( float x )
@@ -234,6 +234,7 @@ void map::add_vehicle_to_cache( vehicle *veh )
         debugmsg( "Tried to add null vehicle to cache" );
         return;
     }
+    content_generation++;
 
     // Get parts
     for( const vpart_reference &vpr : veh->get_all_parts() ) {
@@ -337,6 +338,7 @@ std::unique_ptr<vehicle> map::detach_vehicle( vehicle *veh )
                 overmap_buffer.remove_vehicle( veh );
             }
             dirty_vehicle_list.erase( veh );
+            content_generation++;
             rebuild_vehicle_level_caches();
             return result;
         }
@@ -353,6 +355,7 @@ void map::destroy_vehicle( vehicle *veh )
 
 void map::on_vehicle_moved( const int smz )
 {
+    content_generation++;
     set_outside_cache_dirty( smz );
     set_transparency_cache_dirty( smz );
     set_floor_cache_dirty( smz );
@@ -1358,6 +1361,7 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture, const bool
     }
 
     current_submap->set_furn( l, new_furniture );
+    content_generation++;
 
     // Set the dirty flags
     const furn_t &old_t = old_id.obj();
@@ -1679,6 +1683,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     }
 
     current_submap->set_ter( l, new_terrain );
+    content_generation++;
 
     // Set the dirty flags
     const ter_t &old_t = old_id.obj();
@@ -4218,6 +4223,7 @@ map_stack::iterator map::i_rem( const tripoint &p, const map_stack::const_iterat
     }
 
     current_submap->update_lum_rem( l, *it );
+    content_generation++;
 
     return current_submap->get_items( l ).erase( it );
 }
@@ -4231,6 +4237,29 @@ void map::i_rem( const tripoint &p, item *it )
     }
 }
 
+item map::i_take( const tripoint &p, item *it )
+{
+    map_stack map_items = i_at( p );
+    const map_stack::const_iterator iter = map_items.get_iterator_from_pointer( it );
+    if( iter == map_items.end() ) {
+        debugmsg( "Tried to take an item that is not at %s", p.to_string() );
+        return item();
+    }
+
+    point l;
+    submap *const current_submap = get_submap_at( p, l );
+    current_submap->active_items.remove( it );
+    if( current_submap->active_items.empty() ) {
+        submaps_with_active_items.erase( tripoint( abs_sub.x + p.x / SEEX, abs_sub.y + p.y / SEEY, p.z ) );
+    }
+    // The light cache has to see the item as it is, so it is only moved out afterwards.
+    current_submap->update_lum_rem( l, *it );
+    item taken = std::move( *it );
+    content_generation++;
+    current_submap->get_items( l ).erase( iter );
+    return taken;
+}
+
 void map::i_clear( const tripoint &p )
 {
     point l;
@@ -4250,6 +4279,7 @@ void map::i_clear( const tripoint &p )
 
     current_submap->set_lum( l, 0 );
     current_submap->get_items( l ).clear();
+    content_generation++;
 }
 
 std::vector<item *> map::spawn_items( const tripoint &p, const std::vector<item> &new_items )
@@ -4494,6 +4524,7 @@ item &map::add_item( const tripoint &p, item new_item )
     invalidate_max_populated_zlev( p.z );
 
     current_submap->update_lum_add( l, new_item );
+    content_generation++;
 
     const map_stack::iterator new_pos = current_submap->get_items( l ).insert( new_item );
     if( new_item.needs_processing() ) {
@@ -5256,6 +5287,7 @@ void map::trap_set( const tripoint &p, const trap_id &type )
     }
 
     current_submap->set_trap( l, type );
+    content_generation++;
     if( type != tr_null ) {
         traplocs[type.to_i()].push_back( p );
     }
@@ -5281,6 +5313,7 @@ void map::remove_trap( const tripoint &p )
         }
 
         current_submap->set_trap( l, tr_null );
+        content_generation++;
         auto &traps = traplocs[tid.to_i()];
         const auto iter = std::find( traps.begin(), traps.end(), p );
         if( iter != traps.end() ) {
@@ -5471,6 +5504,7 @@ void map::remove_field( const tripoint &p, const field_type_id &field_to_remove
 
 void map::on_field_modified( const tripoint &p, const field_type &fd_type )
 {
+    content_generation++;
     invalidate_max_populated_zlev( p.z );
 
     get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -6202,7 +6236,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
             }
             return true;
         } );
-        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        skew_vision_cache.insert( key, visible ? 1 : 0 );
         return visible;
     }
 
@@ -6235,10 +6269,30 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         last_point = new_point;
         return true;
     } );
-    skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+    skew_vision_cache.insert( key, visible ? 1 : 0 );
     return visible;
 }
 
+bool map::sees_with_fov( const tripoint &origin, const tripoint &p, const int range ) const
+{
+    if( origin.z != p.z || !inbounds( origin ) ) {
+        return sees( origin, p, range );
+    }
+    if( ( range >= 0 && range < rl_dist( origin, p ) ) || !inbounds( p ) ) {
+        return false;
+    }
+    auto found = los_bitmap_cache.find( origin );
+    if( found == los_bitmap_cache.end() ) {
+        // Creatures move around, so old origins pile up unless the cache gets trimmed.
+        if( los_bitmap_cache.size() >= 64 ) {
+            los_bitmap_cache.clear();
+        }
+        found = los_bitmap_cache.emplace( origin, los_bitmap() ).first;
+        build_los_bitmap( origin, found->second );
+    }
+    return found->second[p.x][p.y];
+}
+
 int map::obstacle_coverage( const tripoint &loc1, const tripoint &loc2 ) const
 {
     // Can't hide if you are standing on furniture, or non-flat slowing-down terrain tile.
@@ -6557,6 +6611,7 @@ void map::load( const tripoint_abs_sm &w, const bool update_vehicle )
     field_furn_locs.clear();
     field_ter_locs.clear();
     submaps_with_active_items.clear();
+    content_generation++;
     // TODO: fix point types
     set_abs_sub( w.raw() );
     clear_vehicle_level_caches();
@@ -7722,6 +7777,7 @@ void map::set_graffiti( const tripoint &p, const std::string &contents )
         return;
     }
     current_submap->set_graffiti( l, contents );
+    content_generation++;
 }
 
 void map::delete_graffiti( const tripoint &p )
@@ -7736,6 +7792,7 @@ void map::delete_graffiti( const tripoint &p )
         return;
     }
     current_submap->delete_graffiti( l );
+    content_generation++;
 }
 
 const std::string &map::graffiti_at( const tripoint &p ) const
@@ -8095,11 +8152,12 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
+    bool transparency_changed = false;
     for( int z = minz; z <= maxz; z++ ) {
         // trigger FOV recalculation only when there is a change on the player's level or if fov_3d is enabled
         const bool affects_seen_cache =  z == zlev || fov_3d;
         build_outside_cache( z );
-        build_transparency_cache( z );
+        transparency_changed |= build_transparency_cache( z );
         bool floor_cache_was_dirty = build_floor_cache( z );
         seen_cache_dirty |= ( floor_cache_was_dirty && affects_seen_cache );
         if( floor_cache_was_dirty && z > -OVERMAP_DEPTH ) {
@@ -8118,6 +8176,10 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     if( seen_cache_dirty ) {
         skew_vision_cache.clear();
     }
+    // fields of view are also kept for NPCs on other levels
+    if( seen_cache_dirty || transparency_changed ) {
+        los_bitmap_cache.clear();
+    }
     // Initial value is illegal player position.
     const tripoint &p = get_player_character().pos();
     static tripoint player_prev_pos;
@@ -15,12 +15,14 @@
 #include <new>
 #include <set>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "calendar.h"
 #include "cata_assert.h"
 #include "cata_utility.h"
+#include "clock_cache.h"
 #include "colony.h"
 #include "coordinate_conversions.h"
 #include "coordinates.h"
@@ -31,7 +33,6 @@
 #include "level_cache.h"
 #include "lightmap.h"
 #include "line.h"
-#include "lru_cache.h"
 #include "map_selector.h"
 #include "mapdata.h"
 #include "optional.h"
@@ -404,6 +405,15 @@ class map
             }
         }
 
+        /**
+         * Changes whenever terrain, furniture, traps, fields, items, graffiti or vehicles
+         * are changed or a new area is loaded. Used to tell whether a rendering of the
+         * map is still current.
+         */
+        uint64_t get_content_generation() const {
+            return content_generation;
+        }
+
         void invalidate_map_cache( const int zlev ) {
             if( inbounds_z( zlev ) ) {
                 level_cache &ch = get_cache( zlev );
@@ -630,6 +640,21 @@ class map
         * Returns whether `F` sees `T` with a view range of `range`.
         */
         bool sees( const tripoint &F, const tripoint &T, int range ) const;
+        /**
+         * Whether `p` is in the field of view shadowcast from `origin`, within `range`.
+         * This is not the same check as @ref sees, which follows a single Bresenham line. The
+         * shadowcast is the one the player's sight uses: a tile is seen if light from the
+         * origin reaches any part of it. Both agree on open ground and behind solid walls, but
+         * next to the corners of obstacles one may see a tile the other does not.
+         * The field of view is computed on the first query and kept until the transparency
+         * changes, so this is cheap when many creatures check whether they see one position.
+         * Falls back to @ref sees for positions on different z-levels.
+         */
+        bool sees_with_fov( const tripoint &origin, const tripoint &p, int range ) const;
+        /** Hit and eviction counts of the cache used by @ref sees, for profiling */
+        const clock_cache<point, char>::statistics &sees_cache_stats() const {
+            return skew_vision_cache.stats();
+        }
     private:
         /**
          * Don't expose the slope adjust outside map functions.
@@ -1195,6 +1220,11 @@ class map
         void i_rem( const point &p, item *it ) {
             i_rem( tripoint( p, abs_sub.z ), it );
         }
+        /**
+         * Removes the item from the tile and returns it. The item is moved out of the map, so
+         * it can be placed somewhere else without copying it.
+         */
+        item i_take( const tripoint &p, item *it );
         void spawn_artifact( const tripoint &p, const relic_procgen_id &id );
         void spawn_item( const tripoint &p, const itype_id &type_id,
                          unsigned quantity = 1, int charges = 0,
@@ -1797,6 +1827,8 @@ class map
          * Sets @ref abs_sub, see there. Uses the same coordinate system as @ref abs_sub.
          */
         void set_abs_sub( const tripoint &p );
+        /** See @ref get_content_generation */
+        uint64_t content_generation = 0;
 
     private:
         field &get_field( const tripoint &p );
@@ -1987,7 +2019,14 @@ class map
         /**
          * Cache of coordinate pairs recently checked for visibility.
          */
-        mutable lru_cache<point, char> skew_vision_cache;
+        mutable clock_cache<point, char> skew_vision_cache{ 100000 };
+        /**
+         * Fields of view used by @ref sees_with_fov, by their origin.
+         * A set bit means the origin is visible from that tile.
+         */
+        using los_bitmap = std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X>;
+        mutable std::unordered_map<tripoint, los_bitmap> los_bitmap_cache;
+        void build_los_bitmap( const tripoint &origin, los_bitmap &output ) const;
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
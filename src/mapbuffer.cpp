@@ -25,6 +25,7 @@
 #include "submap.h"
 #include "translations.h"
 #include "ui_manager.h"
+#include "vehicle.h"
 
 #define dbg(x) DebugLog((x),D_MAP) << __FILE__ << ":" << __LINE__ << ": "
 
@@ -57,6 +58,8 @@ bool mapbuffer::add_submap( const tripoint &p, std::unique_ptr<submap> &sm )
     }
 
     submaps[p] = std::move( sm );
+    // vehicles on the new submap may be the target of power cables
+    vehicle::invalidate_power_grids();
 
     return true;
 }
@@ -69,6 +69,8 @@ class mapbuffer
         // There's a very good reason this is private,
         // if not handled carefully, this can erase in-use submaps and crash the game.
         void remove_submap( tripoint addr );
+        // Lets tests drop submaps that no map has loaded, see remove_submap
+        friend struct mapbuffer_test_helper;
         submap *unserialize_submaps( const tripoint &p );
         void deserialize( JsonIn &jsin );
         void save_quad( const std::string &dirname, const std::string &filename,
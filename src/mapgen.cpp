@@ -10,11 +10,13 @@
 #include <memory>
 #include <new>
 #include <ostream>
+#include <random>
 #include <set>
 #include <stdexcept>
 #include <type_traits>
 #include <unordered_map>
 
+#include "cached_options.h"
 #include "calendar.h"
 #include "cata_assert.h"
 #include "catacharset.h"
@@ -95,12 +97,27 @@ static const mongroup_id GROUP_TURRET( "GROUP_TURRET" );
 
 static const trait_id trait_NPC_STATIC_NPC( "NPC_STATIC_NPC" );
 
+static const option_handle<float> option_ITEM_SPAWNRATE( "ITEM_SPAWNRATE" );
+static const option_handle<float> option_SPAWN_ANIMAL_DENSITY( "SPAWN_ANIMAL_DENSITY" );
+static const option_handle<float> option_SPAWN_DENSITY( "SPAWN_DENSITY" );
+
 #define dbg(x) DebugLog((x),D_MAP_GEN) << __FILE__ << ":" << __LINE__ << ": "
 
 static constexpr int MON_RADIUS = 3;
 
 static void science_room( map *m, const point &p1, const point &p2, int z, int rotate );
 
+unsigned int mapgen_seed( const tripoint_abs_omt &p )
+{
+    // seed_seq mixes all of its input into every output bit, so neighbouring places get
+    // unrelated seeds
+    std::seed_seq seq{ g->get_seed(), static_cast<unsigned int>( p.x() ),
+                       static_cast<unsigned int>( p.y() ), static_cast<unsigned int>( p.z() ) };
+    std::array<unsigned int, 1> seed;
+    seq.generate( seed.begin(), seed.end() );
+    return seed[0];
+}
+
 // (x,y,z) are absolute coordinates of a submap
 // x%2 and y%2 must be 0!
 void map::generate( const tripoint &p, const time_point &when )
@@ -131,6 +148,9 @@ void map::generate( const tripoint &p, const time_point &when )
     // TODO: fix point types
     tripoint_abs_omt abs_omt( sm_to_omt_copy( p ) );
     oter_id terrain_type = overmap_buffer.ter( abs_omt );
+    // Every overmap terrain is generated with its own random numbers, so the result only
+    // depends on the world seed and not on what has been generated or done before.
+    const scoped_rng_stream mapgen_rng( mapgen_seed( abs_omt ) );
 
     // This attempts to scale density of zombies inversely with distance from the nearest city.
     // In other words, make city centers dense and perimeters sparse.
@@ -160,9 +180,9 @@ void map::generate( const tripoint &p, const time_point &when )
 
     float spawn_density = 1.0f;
     if( MonsterGroupManager::is_animal( spawns.group ) ) {
-        spawn_density = get_option< float >( "SPAWN_ANIMAL_DENSITY" );
+        spawn_density = option_SPAWN_ANIMAL_DENSITY.get();
     } else {
-        spawn_density = get_option< float >( "SPAWN_DENSITY" );
+        spawn_density = option_SPAWN_DENSITY.get();
     }
 
     // Apply a multiplier to the number of monsters for really high densities.
@@ -951,6 +971,15 @@ class mapgen_value
             return is_null_;
         }
 
+        /** The id, if it is the same for every run of the mapgen */
+        cata::optional<Id> get_constant() const {
+            const id_source *constant = dynamic_cast<const id_source *>( source_.get() );
+            if( constant == nullptr ) {
+                return cata::nullopt;
+            }
+            return constant->id;
+        }
+
         void check( const std::string &oter_name,
                     const std::unordered_map<std::string, mapgen_parameter> &params ) const {
             source_->check( oter_name, params );
@@ -1513,7 +1542,7 @@ class jmapgen_monster : public jmapgen_piece
             // half the odds at density 1.
             // Instead, apply a multiplier to the number of monsters for really high densities.
             // For example, a 50% chance at spawn density 4 becomes a 75% chance of ~2.7 monsters.
-            int odds_after_density = raw_odds * get_option<float>( "SPAWN_DENSITY" );
+            int odds_after_density = raw_odds * option_SPAWN_DENSITY.get();
             int max_odds = ( 100 + raw_odds ) / 2;
             float density_multiplier = 1.0f;
             if( odds_after_density > max_odds ) {
@@ -1636,7 +1665,7 @@ class jmapgen_spawn_item : public jmapgen_piece
             const int c = chance.get();
 
             // 100% chance = exactly 1 item, otherwise scale by item spawn rate.
-            const float spawn_rate = get_option<float>( "ITEM_SPAWNRATE" );
+            const float spawn_rate = option_ITEM_SPAWNRATE.get();
             int spawn_count = ( c == 100 ) ? 1 : roll_remainder( c * spawn_rate / 100.0f );
             for( int i = 0; i < spawn_count; i++ ) {
                 dat.m.spawn_item( point( x.get(), y.get() ), type, amount.get(),
@@ -1708,6 +1737,20 @@ class jmapgen_furniture : public jmapgen_piece
             return dat.m.veh_at( tripoint( p, dat.zlevel() ) ).has_value();
         }
 };
+
+static void place_terrain( const mapgendata &dat, const point &p, const ter_id &chosen_id )
+{
+    dat.m.ter_set( p, chosen_id );
+    // Delete furniture if a wall was just placed over it. TODO: need to do anything for fluid, monsters?
+    if( dat.m.has_flag_ter( TFLAG_WALL, p ) ) {
+        dat.m.furn_set( p, f_null );
+        // and items, unless the wall has PLACE_ITEM flag indicating it stores things.
+        if( !dat.m.has_flag_ter( "PLACE_ITEM", p ) ) {
+            dat.m.i_clear( tripoint( p, dat.m.get_abs_sub().z ) );
+        }
+    }
+}
+
 /**
  * Place terrain.
  * "ter": id of the terrain.
@@ -1730,15 +1773,7 @@ class jmapgen_terrain : public jmapgen_piece
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            dat.m.ter_set( point( x.get(), y.get() ), chosen_id );
-            // Delete furniture if a wall was just placed over it. TODO: need to do anything for fluid, monsters?
-            if( dat.m.has_flag_ter( "WALL", point( x.get(), y.get() ) ) ) {
-                dat.m.furn_set( point( x.get(), y.get() ), f_null );
-                // and items, unless the wall has PLACE_ITEM flag indicating it stores things.
-                if( !dat.m.has_flag_ter( "PLACE_ITEM", point( x.get(), y.get() ) ) ) {
-                    dat.m.i_clear( tripoint( x.get(), y.get(), dat.m.get_abs_sub().z ) );
-                }
-            }
+            place_terrain( dat, point( x.get(), y.get() ), chosen_id );
         }
         bool has_vehicle_collision( const mapgendata &dat, const point &p ) const override {
             return dat.m.veh_at( tripoint( p, dat.zlevel() ) ).has_value();
@@ -1958,7 +1993,7 @@ class jmapgen_sealed_item : public jmapgen_piece
 
             // 100% chance = always generate, otherwise scale by item spawn rate.
             // (except is capped at 1)
-            const float spawn_rate = get_option<float>( "ITEM_SPAWNRATE" );
+            const float spawn_rate = option_ITEM_SPAWNRATE.get();
             if( !x_in_y( ( c == 100 ) ? 1 : c * spawn_rate / 100.0f, 1 ) ) {
                 return;
             }
@@ -2164,9 +2199,73 @@ bool jmapgen_objects::check_bounds( const jmapgen_place &place, const JsonObject
 void jmapgen_objects::add( const jmapgen_place &place,
                            const shared_ptr_fast<const jmapgen_piece> &piece )
 {
+    instruction next;
+    next.object = objects.size();
+    program.push_back( next );
     objects.emplace_back( place, piece );
 }
 
+static bool is_fixed( const jmapgen_int &value )
+{
+    return value.val == value.valmax;
+}
+
+void jmapgen_objects::compile()
+{
+    // How far back an instruction may join an earlier run, this keeps compiling linear.
+    static constexpr int max_merge_distance = 16;
+
+    program.clear();
+    for( size_t i = 0; i < objects.size(); i++ ) {
+        const jmapgen_place &where = objects[i].first;
+        const jmapgen_piece &what = *objects[i].second;
+        instruction next;
+        next.object = i;
+        if( is_fixed( where.x ) && is_fixed( where.y ) && is_fixed( where.repeat ) &&
+            is_fixed( what.repeat ) && std::max( where.repeat.val, what.repeat.val ) == 1 ) {
+            next.pos = point( where.x.val, where.y.val );
+            if( const jmapgen_terrain *ter = dynamic_cast<const jmapgen_terrain *>( &what ) ) {
+                const cata::optional<ter_id> id = ter->id.get_constant();
+                if( id && id->id().is_null() ) {
+                    // The piece would not do anything.
+                    continue;
+                } else if( id ) {
+                    next.kind = instruction::op::terrain;
+                    next.ter = *id;
+                }
+            } else if( const jmapgen_furniture *furn =
+                           dynamic_cast<const jmapgen_furniture *>( &what ) ) {
+                next.kind = instruction::op::furniture;
+                next.furn = furn->id;
+            }
+        }
+        if( next.kind != instruction::op::object ) {
+            // Terrain and furniture only change their own cell, so the instruction can join an
+            // earlier run on the same row as long as nothing in between touches the same cell.
+            bool merged = false;
+            int distance = 0;
+            for( auto iter = program.rbegin(); iter != program.rend() && !merged &&
+                 distance < max_merge_distance && iter->kind != instruction::op::object;
+                 ++iter, ++distance ) {
+                if( iter->pos.y != next.pos.y ) {
+                    continue;
+                }
+                if( iter->kind == next.kind && iter->ter == next.ter && iter->furn == next.furn &&
+                    iter->pos.x + iter->length == next.pos.x ) {
+                    iter->length++;
+                    merged = true;
+                } else if( next.pos.x >= iter->pos.x && next.pos.x < iter->pos.x + iter->length ) {
+                    break;
+                }
+            }
+            if( merged ) {
+                continue;
+            }
+        }
+        program.push_back( next );
+    }
+}
+
 template<typename PieceType>
 void jmapgen_objects::load_objects( const JsonArray &parray, const std::string &context )
 {
@@ -2197,7 +2296,7 @@ void jmapgen_objects::load_objects<jmapgen_loot>(
 
         auto loot = make_shared_fast<jmapgen_loot>( jsi );
         // spawn rates < 1 are handled in item_group
-        const float rate = std::max( get_option<float>( "ITEM_SPAWNRATE" ), 1.0f );
+        const float rate = std::max( option_ITEM_SPAWNRATE.get(), 1.0f );
 
         if( where.repeat.valmax != 1 ) {
             // if loot can repeat scale according to rate
@@ -2741,6 +2840,7 @@ bool mapgen_function_json_base::setup_common( const JsonObject &jo )
     objects.load_objects<jmapgen_ter_furn_transform>( jo, "place_ter_furn_transforms", context_ );
     // Needs to be last as it affects other placed items
     objects.load_objects<jmapgen_faction>( jo, "faction_owner", context_ );
+    objects.compile();
     if( !mapgen_defer::defer ) {
         is_ready = true; // skip setup attempts from any additional pointers
     }
@@ -3031,37 +3131,49 @@ void mapgen_function_json_nested::nest( const mapgendata &md, const point &offse
  */
 void jmapgen_objects::apply( const mapgendata &dat ) const
 {
-    for( const jmapgen_obj &obj : objects ) {
-        const auto &where = obj.first;
-        const auto &what = *obj.second;
-        // The user will only specify repeat once in JSON, but it may get loaded both
-        // into the what and where in some cases--we just need the greater value of the two.
-        const int repeat = std::max( where.repeat.get(), what.repeat.get() );
-        for( int i = 0; i < repeat; i++ ) {
-            what.apply( dat, where.x, where.y );
-        }
-    }
+    apply( dat, point_zero );
 }
 
 void jmapgen_objects::apply( const mapgendata &dat, const point &offset ) const
 {
-    if( offset == point_zero ) {
-        // It's a bit faster
-        apply( dat );
+    if( test_mode_uncompiled_mapgen ) {
+        for( const jmapgen_obj &obj : objects ) {
+            apply_object( dat, obj, offset );
+        }
         return;
     }
+    for( const instruction &ins : program ) {
+        const point start = ins.pos + offset;
+        switch( ins.kind ) {
+            case instruction::op::terrain:
+                for( int i = 0; i < ins.length; i++ ) {
+                    place_terrain( dat, start + point( i, 0 ), ins.ter );
+                }
+                break;
+            case instruction::op::furniture:
+                for( int i = 0; i < ins.length; i++ ) {
+                    dat.m.furn_set( start + point( i, 0 ), ins.furn );
+                }
+                break;
+            case instruction::op::object:
+                apply_object( dat, objects[ins.object], offset );
+                break;
+        }
+    }
+}
 
-    for( const jmapgen_obj &obj : objects ) {
-        jmapgen_place where = obj.first;
-        where.offset( -offset );
+void jmapgen_objects::apply_object( const mapgendata &dat, const jmapgen_obj &obj,
+                                    const point &offset ) const
+{
+    jmapgen_place where = obj.first;
+    where.offset( -offset );
 
-        const jmapgen_piece &what = *obj.second;
-        // The user will only specify repeat once in JSON, but it may get loaded both
-        // into the what and where in some cases--we just need the greater value of the two.
-        const int repeat = std::max( where.repeat.get(), what.repeat.get() );
-        for( int i = 0; i < repeat; i++ ) {
-            what.apply( dat, where.x, where.y );
-        }
+    const jmapgen_piece &what = *obj.second;
+    // The user will only specify repeat once in JSON, but it may get loaded both
+    // into the what and where in some cases--we just need the greater value of the two.
+    const int repeat = std::max( where.repeat.get(), what.repeat.get() );
+    for( int i = 0; i < repeat; i++ ) {
+        what.apply( dat, where.x, where.y );
     }
 }
 
@@ -4997,9 +5109,9 @@ void map::place_spawns( const mongroup_id &group, const int chance,
 
     float spawn_density = 1.0f;
     if( MonsterGroupManager::is_animal( group ) ) {
-        spawn_density = get_option< float >( "SPAWN_ANIMAL_DENSITY" );
+        spawn_density = option_SPAWN_ANIMAL_DENSITY.get();
     } else {
-        spawn_density = get_option< float >( "SPAWN_DENSITY" );
+        spawn_density = option_SPAWN_DENSITY.get();
     }
 
     float multiplier = density * spawn_density;
@@ -5115,7 +5227,7 @@ std::vector<item *> map::place_items(
     }
 
     // spawn rates < 1 are handled in item_group
-    const float spawn_rate = std::max( get_option<float>( "ITEM_SPAWNRATE" ), 1.0f ) ;
+    const float spawn_rate = std::max( option_ITEM_SPAWNRATE.get(), 1.0f ) ;
     const int spawn_count = roll_remainder( chance * spawn_rate / 100.0f );
     for( int i = 0; i < spawn_count; i++ ) {
         // Might contain one item or several that belong together like guns & their ammo
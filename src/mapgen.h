@@ -317,6 +317,15 @@ struct jmapgen_objects {
         void check( const std::string &context,
                     const std::unordered_map<std::string, mapgen_parameter> & ) const;
 
+        /**
+         * Turns the objects into the list of instructions run by @ref apply. Terrain and
+         * furniture with a fixed id at a fixed point, which is what "rows" places, are set
+         * directly instead of through their pieces, and runs of them along a row are merged.
+         * Must be called again after adding objects, until then they are applied one by one.
+         * The instructions are skipped while @ref test_mode_uncompiled_mapgen is set.
+         */
+        void compile();
+
         void apply( const mapgendata &dat ) const;
         void apply( const mapgendata &dat, const point &offset ) const;
 
@@ -332,6 +341,25 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+
+        struct instruction {
+            enum class op : int {
+                terrain,
+                furniture,
+                object
+            };
+            op kind = op::object;
+            point pos;
+            /** Number of cells along the row, for terrain and furniture */
+            int length = 1;
+            ter_id ter;
+            furn_id furn;
+            /** Index into @ref objects, for op::object */
+            size_t object = 0;
+        };
+        std::vector<instruction> program;
+
+        void apply_object( const mapgendata &dat, const jmapgen_obj &obj, const point &offset ) const;
         point m_offset;
         point mapgensize;
 };
@@ -463,6 +491,12 @@ void calculate_mapgen_weights(); // throws
 
 void check_mapgen_definitions();
 
+/**
+ * Seed of the random numbers used to generate the overmap terrain @p p. It only depends on
+ * the world seed and @p p, so the same place is always generated the same way.
+ */
+unsigned int mapgen_seed( const tripoint_abs_omt &p );
+
 /// move to building_generation
 enum room_type {
     room_null,
@@ -62,6 +62,11 @@ static const trait_id trait_CANNIBAL( "CANNIBAL" );
 static const trait_id trait_PSYCHOPATH( "PSYCHOPATH" );
 static const trait_id trait_SAPIOVORE( "SAPIOVORE" );
 
+static constexpr size_t monster_killer =
+    cata::event::field<event_type::character_kills_monster>( "killer" );
+static constexpr size_t monster_victim_type =
+    cata::event::field<event_type::character_kills_monster>( "victim_type" );
+
 memorial_log_entry::memorial_log_entry( const std::string &preformatted_msg ) :
     preformatted_( preformatted_msg )
 {}
@@ -597,9 +602,10 @@ void memorial_logger::notify( const cata::event &e )
             break;
         }
         case event_type::character_kills_monster: {
-            character_id ch = e.get<character_id>( "killer" );
+            character_id ch = e.get<event_type::character_kills_monster, monster_killer>();
             if( ch == avatar_id ) {
-                mtype_id victim_type = e.get<mtype_id>( "victim_type" );
+                mtype_id victim_type =
+                    e.get<event_type::character_kills_monster, monster_victim_type>();
                 if( victim_type->difficulty >= 30 ) {
                     add( pgettext( "memorial_male", "Killed a %s." ),
                          pgettext( "memorial_female", "Killed a %s." ),
@@ -9,7 +9,11 @@
 #include <memory>
 #include <numeric>
 #include <ostream>
+#include <set>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "active_item_cache.h"
 #include "activity_handlers.h"
@@ -17,6 +21,7 @@
 #include "basecamp.h"
 #include "bionics.h"
 #include "bodypart.h"
+#include "calendar.h"
 #include "cata_algo.h"
 #include "character.h"
 #include "character_id.h"
@@ -29,6 +34,7 @@
 #include "effect.h"
 #include "enums.h"
 #include "explosion.h"
+#include "faction.h"
 #include "field.h"
 #include "field_type.h"
 #include "flag.h"
@@ -188,22 +194,62 @@ const std::vector<bionic_id> weapon_cbms = { {
 
 const int avoidance_vehicles_radius = 5;
 
-bool good_for_pickup( const item &it, npc &who )
-{
-    bool good = false;
+// What an NPC looks for in items. It doesn't change while the NPC looks through the items
+// around it, so it is only computed once for all of them.
+struct pickup_wishes {
+    bool whitelisting;
+    units::mass weight_allowed;
+    int min_value;
+    double weapon_value;
+
+    explicit pickup_wishes( const npc &who ) :
+        whitelisting( who.has_item_whitelist() ),
+        weight_allowed( who.weight_capacity() - who.weight_carried() ),
+        min_value( who.minimum_item_value() ),
+        weapon_value( who.weapon_value( who.weapon ) ) {}
+};
 
-    const bool whitelisting = who.has_item_whitelist();
-    auto weight_allowed = who.weight_capacity() - who.weight_carried();
-    int min_value = who.minimum_item_value();
+bool good_for_pickup( const item &it, npc &who, const pickup_wishes &wishes )
+{
+    return !it.made_of_from_type( phase_id::LIQUID ) &&
+           ( ( !wishes.whitelisting && who.value( it ) > wishes.min_value ) ||
+             who.item_whitelisted( it ) ) &&
+           it.weight() <= wishes.weight_allowed &&
+           ( who.can_stash( it ) || who.weapon_value( it ) > wishes.weapon_value );
+}
 
-    if( ( !it.made_of_from_type( phase_id::LIQUID ) ) &&
-        ( ( !whitelisting && who.value( it ) > min_value ) || who.item_whitelisted( it ) ) &&
-        ( it.weight() <= weight_allowed ) &&
-        ( who.can_stash( it ) || who.weapon_value( it ) > who.weapon_value( who.weapon ) ) ) {
-        good = true;
+// The followers of the player, resolving them through the overmap buffer is slow, so this
+// is done once per search and not for every item.
+std::vector<shared_ptr_fast<npc>> find_followers()
+{
+    std::vector<shared_ptr_fast<npc>> followers;
+    for( const character_id &elem : g->get_follower_list() ) {
+        shared_ptr_fast<npc> npc_to_get = overmap_buffer.find_npc( elem );
+        if( npc_to_get ) {
+            followers.push_back( std::move( npc_to_get ) );
+        }
     }
+    return followers;
+}
 
-    return good;
+// Whether the player or one of their followers sees a place, by its absolute position. This
+// is the same for every NPC that looks for items, so it is shared by all of them for a turn.
+// Followers that move later in the turn are not accounted for.
+std::unordered_map<tripoint, bool> &places_watched_this_turn()
+{
+    static time_point turn = calendar::before_time_starts;
+    static tripoint player_location = tripoint_min;
+    static std::set<character_id> follower_ids;
+    static std::unordered_map<tripoint, bool> watched;
+    const tripoint location = get_avatar().global_square_location();
+    const std::set<character_id> &ids = g->get_follower_list();
+    if( turn != calendar::turn || player_location != location || follower_ids != ids ) {
+        turn = calendar::turn;
+        player_location = location;
+        follower_ids = ids;
+        watched.clear();
+    }
+    return watched;
 }
 
 } // namespace
@@ -2768,34 +2814,49 @@ void npc::find_item()
         return;
     }
 
+    map &here = get_map();
+    const bool has_followers = !g->get_follower_list().empty();
+    // The followers are only resolved if a place is not in the shared cache yet
+    cata::optional<std::vector<shared_ptr_fast<npc>>> followers;
+    std::unordered_map<tripoint, bool> &watched_places = places_watched_this_turn();
+    const auto watched = [&followers, &watched_places, &here]( const tripoint & p ) {
+        const tripoint abs_p = here.getabs( p );
+        const auto found = watched_places.find( abs_p );
+        if( found != watched_places.end() ) {
+            return found->second;
+        }
+        if( !followers ) {
+            followers = find_followers();
+        }
+        const bool ret = get_player_view().sees( p ) ||
+        std::any_of( followers->begin(), followers->end(), [&p]( const shared_ptr_fast<npc> &elem ) {
+            return elem->sees( p );
+        } );
+        watched_places.emplace( abs_p, ret );
+        return ret;
+    };
+    // Ownership is checked for every item nearby, so our faction is only looked up once
+    const faction *const my_fac = get_faction();
+    const auto available_to_take = [my_fac]( const item & it ) {
+        const faction_id owner = it.get_owner();
+        return owner.is_null() || ( my_fac != nullptr && my_fac->id == owner );
+    };
+    const pickup_wishes wishes( *this );
+
     const auto consider_item =
-        [&wanted, &best_value, this]
+        [&wanted, &best_value, has_followers, &watched, &available_to_take, &wishes, this]
     ( const item & it, const tripoint & p ) {
-        std::vector<npc *> followers;
-        for( const character_id &elem : g->get_follower_list() ) {
-            shared_ptr_fast<npc> npc_to_get = overmap_buffer.find_npc( elem );
-            if( !npc_to_get ) {
-                continue;
-            }
-            npc *npc_to_add = npc_to_get.get();
-            followers.push_back( npc_to_add );
-        }
-        viewer &player_view = get_player_view();
-        for( auto &elem : followers ) {
-            if( !it.is_owned_by( *this, true ) && ( player_view.sees( this->pos() ) ||
-                                                    player_view.sees( wanted_item_pos ) ||
-                                                    elem->sees( this->pos() ) || elem->sees( wanted_item_pos ) ) ) {
-                return;
-            }
+        if( has_followers && !available_to_take( it ) &&
+            ( watched( pos() ) || watched( wanted_item_pos ) ) ) {
+            return;
         }
-        if( ::good_for_pickup( it, *this ) ) {
+        if( ::good_for_pickup( it, *this, wishes ) ) {
             wanted_item_pos = p;
             wanted = &( it );
             best_value = has_item_whitelist() ? 1000 : value( it );
         }
     };
 
-    map &here = get_map();
     // Harvest item doesn't exist, so we'll be checking by its name
     std::string wanted_name;
     const auto consider_terrain =
@@ -3009,10 +3070,12 @@ template <typename T>
 std::list<item> npc_pickup_from_stack( npc &who, T &items )
 {
     std::list<item> picked_up;
+    // Picked up items are only added to the inventory at the end, so the wishes stay the same.
+    const pickup_wishes wishes( who );
 
     for( auto iter = items.begin(); iter != items.end(); ) {
         const item &it = *iter;
-        if( ::good_for_pickup( it, who ) ) {
+        if( ::good_for_pickup( it, who, wishes ) ) {
             picked_up.push_back( it );
             iter = items.erase( iter );
         } else {
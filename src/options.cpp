@@ -54,6 +54,8 @@
 std::map<std::string, std::string> TILESETS; // All found tilesets: <name, tileset_dir>
 std::map<std::string, std::string> SOUNDPACKS; // All found soundpacks: <name, soundpack_dir>
 
+unsigned int options_manager::revision_ = 1;
+
 options_manager &get_options()
 {
     static options_manager single_instance;
@@ -734,6 +736,7 @@ int options_manager::cOpt::getMaxLength() const
 //set to next item
 void options_manager::cOpt::setNext()
 {
+    mark_changed();
     if( sType == "string_select" ) {
         int iNext = getItemPos( sSet ) + 1;
         if( iNext >= static_cast<int>( vItems.size() ) ) {
@@ -777,6 +780,7 @@ void options_manager::cOpt::setNext()
 //set to previous item
 void options_manager::cOpt::setPrev()
 {
+    mark_changed();
     if( sType == "string_select" ) {
         int iPrev = static_cast<int>( getItemPos( sSet ) ) - 1;
         if( iPrev < 0 ) {
@@ -815,6 +819,7 @@ void options_manager::cOpt::setPrev()
 //set value
 void options_manager::cOpt::setValue( float fSetIn )
 {
+    mark_changed();
     if( sType != "float" ) {
         debugmsg( "tried to set a float value to a %s option", sType );
         return;
@@ -828,6 +833,7 @@ void options_manager::cOpt::setValue( float fSetIn )
 //set value
 void options_manager::cOpt::setValue( int iSetIn )
 {
+    mark_changed();
     if( sType != "int" ) {
         debugmsg( "tried to set an int value to a %s option", sType );
         return;
@@ -841,6 +847,7 @@ void options_manager::cOpt::setValue( int iSetIn )
 //set value
 void options_manager::cOpt::setValue( const std::string &sSetIn )
 {
+    mark_changed();
     if( sType == "string_select" ) {
         if( getItemPos( sSetIn ) != -1 ) {
             sSet = sSetIn;
@@ -2288,6 +2295,11 @@ void options_manager::add_options_debug()
          to_translation( "If true, file path names are going to be transcoded from system encoding to UTF-8 when reading and will be transcoded back when writing.  Mainly for CJK Windows users." ),
          true
        );
+
+    add( "DEBUG_TILES_REDRAW", "debug", to_translation( "Show terrain redraws" ),
+         to_translation( "If true, outlines the terrain view whenever it is redrawn instead of reused from the previous frame, and shows the frame time." ),
+         false, COPT_CURSES_HIDE
+       );
 }
 
 void options_manager::add_options_android()
@@ -3035,6 +3047,7 @@ std::string options_manager::show( bool ingame, const bool world_options_only,
             if( ingame && world_options_changed ) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            mark_changed();
         }
     }
 
@@ -3213,6 +3226,7 @@ options_manager::options_container options_manager::get_world_defaults() const
 
 void options_manager::set_world_options( options_container *options )
 {
+    mark_changed();
     if( options == nullptr ) {
         world_options.reset();
     } else {
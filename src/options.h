@@ -222,6 +222,14 @@ class options_manager
         /** Check if an option exists? */
         bool has_option( const std::string &name ) const;
 
+        /**
+         * Counter that changes whenever the value of any option may have changed,
+         * @ref option_handle uses it to know when to look its option up again.
+         */
+        static unsigned int revision() {
+            return revision_;
+        }
+
         cOpt &get_option( const std::string &name );
 
         //add hidden external option with value
@@ -269,6 +277,11 @@ class options_manager
                   const std::string &format = "%.2f" );
 
     private:
+        static void mark_changed() {
+            ++revision_;
+        }
+        static unsigned int revision_;
+
         options_container options;
         cata::optional<options_container *> world_options;
 
@@ -324,4 +337,31 @@ inline T get_option( const std::string &name )
     return get_options().get_option( name ).value_as<T>();
 }
 
+/**
+ * Typed handle for an option that is read in code that runs often. It looks the option up
+ * by name on first use and after any option changed, otherwise reading it is a comparison
+ * and a load. Handles are meant to be static:
+ * `static const option_handle<int> autosave_turns( "AUTOSAVE_TURNS" );`
+ */
+template<typename T>
+class option_handle
+{
+    public:
+        explicit option_handle( const std::string &name ) : name( name ) {}
+
+        const T &get() const {
+            if( revision != options_manager::revision() ) {
+                value = get_option<T>( name );
+                revision = options_manager::revision();
+            }
+            return value;
+        }
+
+    private:
+        std::string name;
+        mutable T value = T();
+        // options_manager::revision() starts at 1, so the first read always looks the option up
+        mutable unsigned int revision = 0;
+};
+
 #endif // CATA_SRC_OPTIONS_H
@@ -1096,6 +1096,7 @@ oter_id overmap::get_default_terrain( int z ) const
 
 void overmap::init_layers()
 {
+    terrain_type_index_built = false;
     for( int k = 0; k < OVERMAP_LAYERS; ++k ) {
         const oter_id tid = get_default_terrain( k - OVERMAP_DEPTH );
 
@@ -1116,7 +1117,12 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
         return;
     }
 
-    layer[p.z() + OVERMAP_DEPTH].terrain[p.x()][p.y()] = id;
+    oter_id &current = layer[p.z() + OVERMAP_DEPTH].terrain[p.x()][p.y()];
+    if( terrain_type_index_built && current->get_type_id() != id->get_type_id() ) {
+        unindex_terrain( p, current->get_type_id().id() );
+        index_terrain( p, id->get_type_id().id() );
+    }
+    current = id;
 }
 
 const oter_id &overmap::ter( const tripoint_om_omt &p ) const
@@ -1853,18 +1859,158 @@ const city &overmap::get_nearest_city( const tripoint_om_omt &p ) const
 tripoint_om_omt overmap::find_random_omt( const std::pair<std::string, ot_match_type> &target )
 const
 {
-    std::vector<tripoint_om_omt> valid;
-    for( int i = 0; i < OMAPX; i++ ) {
-        for( int j = 0; j < OMAPY; j++ ) {
-            for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
-                tripoint_om_omt p( i, j, k );
-                if( is_ot_match( target.first, ter( p ), target.second ) ) {
-                    valid.push_back( p );
+    return random_entry( find_all_omt( target ), tripoint_om_omt( tripoint_min ) );
+}
+
+namespace
+{
+/** The overmap terrain matching a search term, see is_ot_match */
+struct terrain_matcher {
+    std::vector<oter_type_id> types;
+    // whether each terrain, by its int id, matches
+    std::vector<bool> terrain;
+};
+} // namespace
+
+static const terrain_matcher &get_terrain_matcher(
+    const std::pair<std::string, ot_match_type> &target )
+{
+    static generic_factory<oter_t>::Version version;
+    static std::map<std::pair<std::string, ot_match_type>, terrain_matcher> matchers;
+    if( !terrains.is_valid( version ) ) {
+        matchers.clear();
+        version = terrains.get_version();
+    }
+    const auto iter = matchers.find( target );
+    if( iter != matchers.end() ) {
+        return iter->second;
+    }
+
+    terrain_matcher &matcher = matchers[target];
+    const std::vector<oter_t> &all = terrains.get_all();
+    matcher.terrain.resize( all.size() );
+    for( const oter_t &oter : all ) {
+        const oter_id id = oter.id.id();
+        if( !is_ot_match( target.first, id, target.second ) ) {
+            continue;
+        }
+        matcher.terrain[id.to_i()] = true;
+        const oter_type_id type = oter.get_type_id().id();
+        if( std::find( matcher.types.begin(), matcher.types.end(), type ) == matcher.types.end() ) {
+            matcher.types.push_back( type );
+        }
+    }
+    return matcher;
+}
+
+bool overmap::is_filler_terrain_type( const oter_type_id &type ) const
+{
+    return std::find( terrain_type_filler.begin(), terrain_type_filler.end(),
+                      type.to_i() ) != terrain_type_filler.end();
+}
+
+void overmap::index_terrain( const tripoint_om_omt &p, const oter_type_id &type ) const
+{
+    if( is_filler_terrain_type( type ) ) {
+        return;
+    }
+    std::vector<tripoint_om_omt> &places = terrain_type_index[type.to_i()];
+    terrain_type_slots[p] = places.size();
+    places.push_back( p );
+}
+
+void overmap::unindex_terrain( const tripoint_om_omt &p, const oter_type_id &type ) const
+{
+    const auto slot = terrain_type_slots.find( p );
+    if( slot == terrain_type_slots.end() ) {
+        return;
+    }
+    // move the last place into the freed slot
+    std::vector<tripoint_om_omt> &places = terrain_type_index[type.to_i()];
+    const tripoint_om_omt moved = places.back();
+    places[slot->second] = moved;
+    terrain_type_slots[moved] = slot->second;
+    places.pop_back();
+    terrain_type_slots.erase( p );
+}
+
+void overmap::find_filler_terrain_types() const
+{
+    static const oter_type_str_id empty_rock( "empty_rock" );
+    static const oter_type_str_id open_air( "open_air" );
+
+    terrain_type_filler = { empty_rock.id().to_i(), open_air.id().to_i() };
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        const int default_type = get_default_terrain( z )->get_type_id().id().to_i();
+        if( !is_filler_terrain_type( oter_type_id( default_type ) ) ) {
+            terrain_type_filler.push_back( default_type );
+        }
+    }
+}
+
+void overmap::build_terrain_type_index() const
+{
+    terrain_type_index.clear();
+    terrain_type_slots.clear();
+    find_filler_terrain_types();
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const tripoint_om_omt p( x, y, z );
+                index_terrain( p, ter( p )->get_type_id().id() );
+            }
+        }
+    }
+    terrain_type_index_built = true;
+}
+
+bool overmap::is_indexed_terrain( const std::pair<std::string, ot_match_type> &target ) const
+{
+    if( terrain_type_filler.empty() ) {
+        find_filler_terrain_types();
+    }
+    const terrain_matcher &matcher = get_terrain_matcher( target );
+    return std::none_of( matcher.types.begin(), matcher.types.end(),
+    [this]( const oter_type_id & type ) {
+        return is_filler_terrain_type( type );
+    } );
+}
+
+std::vector<tripoint_om_omt> overmap::find_all_omt(
+    const std::pair<std::string, ot_match_type> &target ) const
+{
+    if( !terrain_type_index_built ) {
+        build_terrain_type_index();
+    }
+    const terrain_matcher &matcher = get_terrain_matcher( target );
+    std::vector<tripoint_om_omt> result;
+    if( !is_indexed_terrain( target ) ) {
+        // filler terrain is not indexed, look at every place
+        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+            for( int x = 0; x < OMAPX; x++ ) {
+                for( int y = 0; y < OMAPY; y++ ) {
+                    const tripoint_om_omt p( x, y, z );
+                    if( matcher.terrain[ter( p ).to_i()] ) {
+                        result.push_back( p );
+                    }
                 }
             }
         }
+        return result;
     }
-    return random_entry( valid, tripoint_om_omt( tripoint_min ) );
+    for( const oter_type_id &type : matcher.types ) {
+        const auto iter = terrain_type_index.find( type.to_i() );
+        if( iter == terrain_type_index.end() ) {
+            continue;
+        }
+        // not all rotations or line pieces of a type have to match the search
+        for( const tripoint_om_omt &p : iter->second ) {
+            if( matcher.terrain[ter( p ).to_i()] ) {
+                result.push_back( p );
+            }
+        }
+    }
+    return result;
 }
 
 void overmap::process_mongroups()
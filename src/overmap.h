@@ -230,6 +230,18 @@ class overmap
          * Returns @ref invalid_tripoint if no suitable place has been found.
          */
         tripoint_om_omt find_random_omt( const std::pair<std::string, ot_match_type> &target ) const;
+        /**
+         * @return The (local) overmap terrain coordinates of every place on the overmap, on
+         * any z-level, whose terrain matches @p target. They are looked up in an index of the
+         * terrain types, which is built on the first search and then kept current by ter_set.
+         */
+        std::vector<tripoint_om_omt> find_all_omt( const std::pair<std::string, ot_match_type> &target )
+        const;
+        /**
+         * Whether @ref find_all_omt finds @p target through the index. Filler terrain is not
+         * indexed, so searches that match it look at every place of the overmap.
+         */
+        bool is_indexed_terrain( const std::pair<std::string, ot_match_type> &target ) const;
         tripoint_om_omt find_random_omt( const std::string &omt_base_type,
                                          ot_match_type match_type = ot_match_type::type ) const {
             return find_random_omt( std::make_pair( omt_base_type, match_type ) );
@@ -361,6 +373,21 @@ class overmap
         std::array<map_layer, OVERMAP_LAYERS> layer;
         std::unordered_map<tripoint_abs_omt, scent_trace> scents;
 
+        // Places of each overmap terrain type, by the int id of the type, see find_all_omt.
+        // Filler terrain (rock, open air and the default terrain of each layer) covers most
+        // of the overmap and is left out, searches for it scan the layers instead.
+        mutable std::unordered_map<int, std::vector<tripoint_om_omt>> terrain_type_index;
+        // Slot of each indexed place in its terrain_type_index entry, for O(1) removal
+        mutable std::unordered_map<tripoint_om_omt, size_t> terrain_type_slots;
+        // Int ids of the filler terrain types, see terrain_type_index
+        mutable std::vector<int> terrain_type_filler;
+        mutable bool terrain_type_index_built = false;
+        void find_filler_terrain_types() const;
+        void build_terrain_type_index() const;
+        bool is_filler_terrain_type( const oter_type_id &type ) const;
+        void index_terrain( const tripoint_om_omt &p, const oter_type_id &type ) const;
+        void unindex_terrain( const tripoint_om_omt &p, const oter_type_id &type ) const;
+
         // Records the locations where a given overmap special was placed, which
         // can be used after placement to lookup whether a given location was created
         // as part of a special.
@@ -1,6 +1,7 @@
 #include "overmapbuffer.h"
 
 #include <algorithm>
+#include <array>
 #include <climits>
 #include <iterator>
 #include <list>
@@ -108,6 +109,38 @@ void overmapbuffer::create_custom_overmap( const point_abs_om &p, overmap_specia
     new_om.populate( specials );
 }
 
+bool overmapbuffer::pregenerate_adjacent( const tripoint_abs_omt &center, const int margin,
+        const point &heading )
+{
+    point_abs_om om_pos;
+    tripoint_om_omt local;
+    std::tie( om_pos, local ) = project_remain<coords::om>( center );
+    const auto near_border = [margin]( const int offset, const int pos, const int size ) {
+        return offset == 0 || ( offset < 0 ? pos < margin : pos >= size - margin );
+    };
+    // without a heading every direction counts as ahead
+    const auto ahead = [&heading]( const int offset, const int dir ) {
+        return heading == point_zero || offset == 0 ||
+               ( dir != 0 && ( offset < 0 ) == ( dir < 0 ) );
+    };
+    // the sides come first, a corner is only reached by passing a side
+    static constexpr std::array<point, 8> neighbour_offsets = { {
+            point_north, point_east, point_south, point_west,
+            point_north_east, point_south_east, point_south_west, point_north_west
+        }
+    };
+    for( const point &offset : neighbour_offsets ) {
+        const point_abs_om neighbour = om_pos + offset;
+        if( near_border( offset.x, local.x(), OMAPX ) &&
+            near_border( offset.y, local.y(), OMAPY ) &&
+            ahead( offset.x, heading.x ) && ahead( offset.y, heading.y ) && !has( neighbour ) ) {
+            get( neighbour );
+            return true;
+        }
+    }
+    return false;
+}
+
 void overmapbuffer::fix_mongroups( overmap &new_overmap )
 {
     for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ) {
@@ -201,6 +234,18 @@ void overmapbuffer::save()
     }
 }
 
+void overmapbuffer::discard( const point_abs_om &p )
+{
+    const auto it = overmaps.find( p );
+    if( it == overmaps.end() ) {
+        return;
+    }
+    if( last_requested_overmap == it->second.get() ) {
+        last_requested_overmap = nullptr;
+    }
+    overmaps.erase( it );
+}
+
 void overmapbuffer::clear()
 {
     overmaps.clear();
@@ -957,6 +1002,41 @@ tripoint_abs_omt overmapbuffer::find_closest(
     return find_closest( origin, params );
 }
 
+std::vector<tripoint_abs_omt> overmapbuffer::find_terrain_on_overmap( const point_abs_om &om_pos,
+        const omt_find_params &params )
+{
+    std::vector<tripoint_abs_omt> result;
+    const overmap *om = params.existing_only ? get_existing( om_pos ) : &get( om_pos );
+    if( om == nullptr ) {
+        return result;
+    }
+    for( const std::pair<std::string, ot_match_type> &type : params.types ) {
+        for( const tripoint_om_omt &p : om->find_all_omt( type ) ) {
+            result.push_back( project_combine( om_pos, p ) );
+        }
+    }
+    if( params.types.size() > 1 ) {
+        // a location can match several of the types
+        std::sort( result.begin(), result.end() );
+        result.erase( std::unique( result.begin(), result.end() ), result.end() );
+    }
+    return result;
+}
+
+bool overmapbuffer::can_search_terrain_index( const tripoint_abs_omt &origin,
+        const omt_find_params &params )
+{
+    const point_abs_om om_pos = project_to<coords::om>( origin.xy() );
+    const overmap *om = params.existing_only ? get_existing( om_pos ) : &get( om_pos );
+    if( om == nullptr ) {
+        return false;
+    }
+    return std::all_of( params.types.begin(), params.types.end(),
+    [om]( const std::pair<std::string, ot_match_type> &type ) {
+        return om->is_indexed_terrain( type );
+    } );
+}
+
 tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
@@ -983,28 +1063,77 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
     const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX * 5;
 
+    const point_abs_omt origin_xy = origin.xy();
     std::vector<tripoint_abs_omt> result;
     cata::optional<int> found_dist;
 
-    for( const point_abs_omt &loc_xy : closest_points_first( origin.xy(), min_dist, max_dist ) ) {
-        const int dist_xy = square_dist( origin.xy(), loc_xy );
+    if( !can_search_terrain_index( origin, params ) ) {
+        for( const point_abs_omt &loc_xy : closest_points_first( origin_xy, min_dist, max_dist ) ) {
+            const int dist_xy = square_dist( origin_xy, loc_xy );
 
-        if( found_dist && *found_dist < dist_xy ) {
-            break;
+            if( found_dist && *found_dist < dist_xy ) {
+                break;
+            }
+
+            for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+                const tripoint_abs_omt loc( loc_xy, z );
+                const int dist = square_dist( origin, loc );
+
+                if( found_dist && *found_dist < dist ) {
+                    continue;
+                }
+
+                if( !is_findable_location( loc, params ) ) {
+                    continue;
+                }
+                if( !found_dist || dist < *found_dist ) {
+                    found_dist = dist;
+                    result.clear();
+                }
+                result.push_back( loc );
+            }
+        }
+        return random_entry( result, overmap::invalid_tripoint );
+    }
+
+    // Overmaps in the order of their closest point to the origin. They are only created once
+    // the search reaches them, and the search stops at the first one that is farther away than
+    // the closest match.
+    const point_abs_om om_min = project_to<coords::om>( origin_xy - point( max_dist, max_dist ) );
+    const point_abs_om om_max = project_to<coords::om>( origin_xy + point( max_dist, max_dist ) );
+    std::vector<std::pair<int, point_abs_om>> oms;
+    for( int x = om_min.x(); x <= om_max.x(); x++ ) {
+        for( int y = om_min.y(); y <= om_max.y(); y++ ) {
+            const point_abs_om om_pos( x, y );
+            const point_abs_omt corner = project_to<coords::omt>( om_pos );
+            const point_abs_omt closest( clamp( origin_xy.x(), corner.x(), corner.x() + OMAPX - 1 ),
+                                         clamp( origin_xy.y(), corner.y(), corner.y() + OMAPY - 1 ) );
+            oms.emplace_back( square_dist( origin_xy, closest ), om_pos );
         }
+    }
+    std::sort( oms.begin(), oms.end() );
 
-        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-            const tripoint_abs_omt loc( loc_xy, z );
+    for( const std::pair<int, point_abs_om> &om : oms ) {
+        if( found_dist && *found_dist < om.first ) {
+            break;
+        }
+        for( const tripoint_abs_omt &loc : find_terrain_on_overmap( om.second, params ) ) {
+            const int dist_xy = square_dist( origin_xy, loc.xy() );
+            if( dist_xy < min_dist || dist_xy > max_dist ) {
+                continue;
+            }
             const int dist = square_dist( origin, loc );
-
             if( found_dist && *found_dist < dist ) {
                 continue;
             }
-
-            if( is_findable_location( loc, params ) ) {
+            if( !is_findable_location( loc, params ) ) {
+                continue;
+            }
+            if( !found_dist || dist < *found_dist ) {
                 found_dist = dist;
-                result.push_back( loc );
+                result.clear();
             }
+            result.push_back( loc );
         }
     }
 
@@ -1014,17 +1143,45 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
 std::vector<tripoint_abs_omt> overmapbuffer::find_all( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
-    std::vector<tripoint_abs_omt> result;
+    std::vector<std::pair<int, tripoint_abs_omt>> found;
     // dist == 0 means search a whole overmap diameter.
     const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX;
 
-    for( const tripoint_abs_omt &loc : closest_points_first( origin, min_dist, max_dist ) ) {
-        if( is_findable_location( loc, params ) ) {
-            result.push_back( loc );
+    if( !can_search_terrain_index( origin, params ) ) {
+        std::vector<tripoint_abs_omt> result;
+        for( const tripoint_abs_omt &loc : closest_points_first( origin, min_dist, max_dist ) ) {
+            if( is_findable_location( loc, params ) ) {
+                result.push_back( loc );
+            }
         }
+        return result;
     }
 
+    const point_abs_omt origin_xy = origin.xy();
+    const point_abs_om om_min = project_to<coords::om>( origin_xy - point( max_dist, max_dist ) );
+    const point_abs_om om_max = project_to<coords::om>( origin_xy + point( max_dist, max_dist ) );
+    for( int x = om_min.x(); x <= om_max.x(); x++ ) {
+        for( int y = om_min.y(); y <= om_max.y(); y++ ) {
+            for( const tripoint_abs_omt &loc : find_terrain_on_overmap( point_abs_om( x, y ), params ) ) {
+                if( loc.z() != origin.z() ) {
+                    continue;
+                }
+                const int dist = square_dist( origin_xy, loc.xy() );
+                if( dist >= min_dist && dist <= max_dist && is_findable_location( loc, params ) ) {
+                    found.emplace_back( dist, loc );
+                }
+            }
+        }
+    }
+
+    // closest first
+    std::sort( found.begin(), found.end() );
+    std::vector<tripoint_abs_omt> result;
+    result.reserve( found.size() );
+    for( const std::pair<int, tripoint_abs_omt> &elem : found ) {
+        result.push_back( elem.second );
+    }
     return result;
 }
 
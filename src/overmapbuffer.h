@@ -138,6 +138,17 @@ class overmapbuffer
         void save();
         void clear();
         void create_custom_overmap( const point_abs_om &, overmap_special_batch &specials );
+        /**
+         * Generates one missing overmap next to the one containing @p center, if @p center
+         * is at most @p margin overmap terrain tiles away from the border to it.
+         * Generating an overmap causes a noticeable pause, this allows doing it ahead of time
+         * while the player is busy with something else, instead of when they cross the border.
+         * @param heading If not zero, only overmaps in this direction are generated, e.g.
+         * only the one to the east when moving east.
+         * @returns true if an overmap was generated.
+         */
+        bool pregenerate_adjacent( const tripoint_abs_omt &center, int margin,
+                                   const point &heading = point_zero );
 
         /**
          * Uses global overmap terrain coordinates, creates the
@@ -482,6 +493,20 @@ class overmapbuffer
          * see omt_find_params for definitions of the terms
          */
         bool is_findable_location( const tripoint_abs_omt &location, const omt_find_params &params );
+        /**
+         * Locations on the overmap at @p om_pos with terrain that matches one of the types in
+         * @p params, see overmap::find_all_omt. The overmap is created if needed, unless
+         * params.existing_only is set.
+         */
+        std::vector<tripoint_abs_omt> find_terrain_on_overmap( const point_abs_om &om_pos,
+                const omt_find_params &params );
+        /**
+         * Whether a search for @p params near @p origin can use the terrain index of the
+         * overmaps. Searches for filler terrain look at the places within the search range one
+         * by one instead, as the index would have them scan whole overmaps.
+         */
+        bool can_search_terrain_index( const tripoint_abs_omt &origin,
+                                       const omt_find_params &params );
 
         std::unordered_map< point_abs_om, std::unique_ptr< overmap > > overmaps;
         /**
@@ -541,6 +566,14 @@ class overmapbuffer
          */
         std::vector<overmap *> get_overmaps_near( const point_abs_sm &p, int radius );
         std::vector<overmap *> get_overmaps_near( const tripoint_abs_sm &location, int radius );
+        /**
+         * Drops the overmap at @p p from the buffer without saving it.
+         * Pointers and references to it become invalid.
+         */
+        void discard( const point_abs_om &p );
+
+        // Lets tests drop the overmaps they generated, see discard
+        friend struct overmapbuffer_test_helper;
 };
 
 extern overmapbuffer overmap_buffer;
@@ -18,7 +18,7 @@ struct point;
 
 namespace activity_level
 {
-const std::string activity_level_str( float level );
+std::string activity_level_str( float level );
 } // namespace activity_level
 
 namespace catacurses
@@ -51,6 +51,30 @@ static std::set<const recipe *> null_match;
 
 static DynamicDataLoader::deferred_json deferred;
 
+namespace
+{
+// Lower-case result names of recipes for name searches, filled on demand
+struct recipe_name_index {
+    int language_version = INVALID_LANGUAGE_VERSION;
+    std::unordered_map<const recipe *, std::string> names;
+};
+} // namespace
+
+static recipe_name_index name_index;
+
+static const std::string &lowercase_result_name( const recipe &r )
+{
+    if( name_index.language_version != detail::get_current_language_version() ) {
+        name_index.names.clear();
+        name_index.language_version = detail::get_current_language_version();
+    }
+    auto iter = name_index.names.find( &r );
+    if( iter == name_index.names.end() ) {
+        iter = name_index.names.emplace( &r, lcmatch_lower( item::nname( r.result() ) ) ).first;
+    }
+    return iter->second;
+}
+
 template<>
 const recipe &string_id<recipe>::obj() const
 {
@@ -148,16 +172,31 @@ std::vector<const recipe *> recipe_subset::search(
     const std::string &txt, const search_type key,
     const std::function<void( size_t, size_t )> &progress_callback ) const
 {
+    std::string needle;
+    if( key == search_type::name || key == search_type::exclude_name ) {
+        needle = lcmatch_lower( txt );
+    }
+    // Same as lcmatch( r.result_name(), txt ), using the cached lower-case name
+    const auto name_matches = [&]( const recipe & r ) {
+        const std::string &name = lowercase_result_name( r );
+        if( name.find( needle ) != std::string::npos ) {
+            return true;
+        }
+        // result_name() marks favorites with a "* " prefix
+        return uistate.favorite_recipes.count( r.ident() ) > 0 &&
+               ( "* " + name ).find( needle ) != std::string::npos;
+    };
+
     auto predicate = [&]( const recipe * r ) {
         if( !*r || r->obsolete ) {
             return false;
         }
         switch( key ) {
             case search_type::name:
-                return lcmatch( r->result_name(), txt );
+                return name_matches( *r );
 
             case search_type::exclude_name:
-                return !lcmatch( r->result_name(), txt );
+                return !name_matches( *r );
 
             case search_type::skill:
                 return lcmatch( r->required_skills_string( nullptr, true, false ), txt );
@@ -411,6 +450,46 @@ std::map<recipe_id, recipe>::const_iterator recipe_dictionary::end() const
     return recipes.end();
 }
 
+const std::set<const recipe *> &recipe_dictionary::using_item( const itype_id &id ) const
+{
+    const auto iter = item_users.find( id );
+    return iter != item_users.end() ? iter->second : null_match;
+}
+
+const std::set<const recipe *> &recipe_dictionary::using_quality( const quality_id &id ) const
+{
+    const auto iter = quality_users.find( id );
+    return iter != quality_users.end() ? iter->second : null_match;
+}
+
+void recipe_dictionary::find_requirement_users()
+{
+    item_users.clear();
+    quality_users.clear();
+    for( const std::pair<const recipe_id, recipe> &p : recipes ) {
+        const recipe *r = &p.second;
+        if( r->obsolete ) {
+            continue;
+        }
+        const requirement_data &reqs = r->simple_requirements();
+        for( const std::vector<item_comp> &opts : reqs.get_components() ) {
+            for( const item_comp &comp : opts ) {
+                item_users[comp.type].insert( r );
+            }
+        }
+        for( const std::vector<tool_comp> &opts : reqs.get_tools() ) {
+            for( const tool_comp &tool : opts ) {
+                item_users[tool.type].insert( r );
+            }
+        }
+        for( const std::vector<quality_requirement> &opts : reqs.get_qualities() ) {
+            for( const quality_requirement &qual : opts ) {
+                quality_users[qual.type].insert( r );
+            }
+        }
+    }
+}
+
 bool recipe_dictionary::is_item_on_loop( const itype_id &i ) const
 {
     return items_on_loops.count( i );
@@ -546,6 +625,7 @@ void recipe_dictionary::finalize()
     }
 
     recipe_dict.find_items_on_loops();
+    recipe_dict.find_requirement_users();
 }
 
 void recipe_dictionary::check_consistency()
@@ -594,12 +674,20 @@ void recipe_dictionary::reset()
     recipe_dict.recipes.clear();
     recipe_dict.uncraft.clear();
     recipe_dict.items_on_loops.clear();
+    recipe_dict.item_users.clear();
+    recipe_dict.quality_users.clear();
+    name_index.names.clear();
 }
 
 void recipe_dictionary::delete_if( const std::function<bool( const recipe & )> &pred )
 {
     ::delete_if( recipe_dict.recipes, pred );
     ::delete_if( recipe_dict.uncraft, pred );
+    // Indices hold pointers to recipes, refresh them if they were already built
+    if( !recipe_dict.item_users.empty() || !recipe_dict.quality_users.empty() ) {
+        recipe_dict.find_requirement_users();
+    }
+    name_index.names.clear();
 }
 
 void recipe_subset::include( const recipe *r, int custom_difficulty )
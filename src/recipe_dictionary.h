@@ -41,6 +41,11 @@ class recipe_dictionary
 
         bool is_item_on_loop( const itype_id & ) const;
 
+        /** Returns all recipes that use the item as a component or tool */
+        const std::set<const recipe *> &using_item( const itype_id &id ) const;
+        /** Returns all recipes that require the tool quality */
+        const std::set<const recipe *> &using_quality( const quality_id &id ) const;
+
         /** Returns disassembly recipe (or null recipe if no match) */
         static const recipe &get_uncraft( const itype_id &id );
 
@@ -67,9 +72,12 @@ class recipe_dictionary
         std::set<const recipe *> autolearn;
         std::set<const recipe *> blueprints;
         std::unordered_set<itype_id> items_on_loops;
+        std::map<itype_id, std::set<const recipe *>> item_users;
+        std::map<quality_id, std::set<const recipe *>> quality_users;
 
         static void finalize_internal( std::map<recipe_id, recipe> &obj );
         void find_items_on_loops();
+        void find_requirement_users();
 };
 
 extern recipe_dictionary recipe_dict;
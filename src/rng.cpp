@@ -141,3 +141,13 @@ void rng_set_engine_seed( unsigned int seed )
         rng_get_engine().seed( seed );
     }
 }
+
+scoped_rng_stream::scoped_rng_stream( const unsigned int seed ) : saved_engine( rng_get_engine() )
+{
+    rng_get_engine().seed( seed );
+}
+
+scoped_rng_stream::~scoped_rng_stream()
+{
+    rng_get_engine() = saved_engine;
+}
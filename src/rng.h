@@ -27,6 +27,22 @@ void rng_set_engine_seed( unsigned int seed );
 
 using cata_default_random_engine = std::minstd_rand0;
 cata_default_random_engine &rng_get_engine();
+
+/**
+ * While this exists, the engine is seeded with the given seed. The previous state of the
+ * engine is restored afterwards. The random numbers drawn in between only depend on the seed,
+ * and the code around it gets the same random numbers as if nothing had been drawn.
+ */
+class scoped_rng_stream
+{
+    public:
+        explicit scoped_rng_stream( unsigned int seed );
+        scoped_rng_stream( const scoped_rng_stream & ) = delete;
+        scoped_rng_stream &operator=( const scoped_rng_stream & ) = delete;
+        ~scoped_rng_stream();
+    private:
+        cata_default_random_engine saved_engine;
+};
 unsigned int rng_bits();
 
 int rng( int lo, int hi );
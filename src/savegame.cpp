@@ -492,6 +492,8 @@ void overmap::load_legacy_monstergroups( JsonIn &jsin )
 // throws std::exception
 void overmap::unserialize( std::istream &fin )
 {
+    // the terrain is read directly into the layers
+    terrain_type_index_built = false;
     chkversion( fin );
     JsonIn jsin( fin );
     jsin.start_object();
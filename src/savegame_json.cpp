@@ -2564,8 +2564,8 @@ void item::io( Archive &archive )
     // counter, it will always be 0 and it prevents proper stacking.
     if( get_chapters() == 0 ) {
         for( auto it = item_vars.begin(); it != item_vars.end(); ) {
-            if( it->first.compare( 0, 19, "remaining-chapters-" ) == 0 ) {
-                item_vars.erase( it++ );
+            if( it->key().compare( 0, 19, "remaining-chapters-" ) == 0 ) {
+                it = item_vars.erase( it );
             } else {
                 ++it;
             }
@@ -2596,6 +2596,8 @@ void item::io( Archive &archive )
         }
         charges = 0;
     }
+    // item vars and flags were assigned directly
+    revision = new_revision();
 }
 
 void item::migrate_content_item( const item &contained )
@@ -3964,6 +3966,7 @@ void event_multiset::deserialize( JsonIn &jsin )
     JsonObject jo = jsin.get_object();
     jo.allow_omitted_members();
     JsonArray events = jo.get_array( "event_counts" );
+    summaries_by_values_.clear();
     if( !events.empty() && events.get_array( 0 ).has_int( 1 ) ) {
         // TEMPORARY until 0.F
         // Read legacy format with just ints
@@ -1,5 +1,9 @@
 #if defined(TILES)
 #include "sdl_font.h"
+
+#include <algorithm>
+#include <vector>
+
 #include "output.h"
 
 #if defined(_WIN32)
@@ -278,12 +282,12 @@ CachedTTFFont::CachedTTFFont(
     TTF_SetFontStyle( font.get(), TTF_STYLE_NORMAL );
 }
 
-SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
-        const std::string &ch,
-        const int color )
+SDL_Surface_Ptr CachedTTFFont::create_glyph( const std::string &ch )
 {
+    // Rendered in white, the color is applied as texture color modulation when drawing.
+    static const SDL_Color white = { 255, 255, 255, 255 };
     const auto function = fontblending ? TTF_RenderUTF8_Blended : TTF_RenderUTF8_Solid;
-    SDL_Surface_Ptr sglyph( function( font.get(), ch.c_str(), windowsPalette[color] ) );
+    SDL_Surface_Ptr sglyph( function( font.get(), ch.c_str(), white ) );
     if( !sglyph ) {
         dbg( D_ERROR ) << "Failed to create glyph for " << ch << ": " << TTF_GetError();
         return nullptr;
@@ -302,8 +306,6 @@ SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
     static const Uint32 amask = 0xff000000;
 #endif
     const int wf = utf8_wrapper( ch ).display_width();
-    // Note: bits per pixel must be 8 to be synchronized with the surface
-    // that TTF_RenderGlyph above returns. This is important for SDL_BlitScaled
     SDL_Surface_Ptr surface = CreateRGBSurface( 0, width * wf, height, 32, rmask, gmask, bmask,
                               amask );
     SDL_Rect src_rect = { 0, 0, sglyph->w, sglyph->h };
@@ -323,12 +325,92 @@ SDL_Texture_Ptr CachedTTFFont::create_glyph( const SDL_Renderer_Ptr &renderer,
         src_rect.h = dst_rect.h;
     }
 
-    if( !printErrorIf( SDL_BlitSurface( sglyph.get(), &src_rect, surface.get(), &dst_rect ) != 0,
-                       "SDL_BlitSurface failed" ) ) {
-        sglyph = std::move( surface );
+    // The atlas is uploaded as raw pixels, so the glyph has to be in the surface format
+    // even if blitting fails.
+    printErrorIf( SDL_BlitSurface( sglyph.get(), &src_rect, surface.get(), &dst_rect ) != 0,
+                  "SDL_BlitSurface failed" );
+    return surface;
+}
+
+bool CachedTTFFont::add_atlas_page( const SDL_Renderer_Ptr &renderer )
+{
+    if( atlas_size == 0 ) {
+        SDL_RendererInfo info;
+        atlas_size = 1024;
+        if( SDL_GetRendererInfo( renderer.get(), &info ) == 0 ) {
+            if( info.max_texture_width > 0 ) {
+                atlas_size = std::min( atlas_size, info.max_texture_width );
+            }
+            if( info.max_texture_height > 0 ) {
+                atlas_size = std::min( atlas_size, info.max_texture_height );
+            }
+        }
+    }
+    // Same byte order as the surfaces made by create_glyph
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    static const Uint32 format = SDL_PIXELFORMAT_RGBA8888;
+#else
+    static const Uint32 format = SDL_PIXELFORMAT_ABGR8888;
+#endif
+    SDL_Texture_Ptr texture = CreateTexture( renderer, format, SDL_TEXTUREACCESS_STATIC,
+                              atlas_size, atlas_size );
+    if( !texture ) {
+        return false;
+    }
+    // Static textures start out undefined, clear it to transparent.
+    const std::vector<Uint32> empty( static_cast<size_t>( atlas_size ) * atlas_size, 0 );
+    if( printErrorIf( SDL_UpdateTexture( texture.get(), nullptr, empty.data(),
+                                         atlas_size * sizeof( Uint32 ) ) != 0,
+                      "SDL_UpdateTexture failed" ) ) {
+        return false;
+    }
+    SetTextureBlendMode( texture, SDL_BLENDMODE_BLEND );
+    atlas.push_back( atlas_page{ std::move( texture ), SDL_Color{ 255, 255, 255, 255 } } );
+    atlas_cursor = point_zero;
+    return true;
+}
+
+const CachedTTFFont::glyph_t &CachedTTFFont::get_glyph( const SDL_Renderer_Ptr &renderer,
+        const std::string &ch )
+{
+    auto it = glyph_cache_map.find( ch );
+    if( it != glyph_cache_map.end() ) {
+        return it->second;
+    }
+    glyph_t glyph{ -1, SDL_Rect{ 0, 0, 0, 0 } };
+    SDL_Surface_Ptr surface = create_glyph( ch );
+    if( surface && ( !atlas.empty() || add_atlas_page( renderer ) ) ) {
+        // Pack the glyphs into rows, leaving a pixel between them so scaled rendering
+        // does not bleed neighbours in.
+        if( atlas_cursor.x + surface->w > atlas_size ) {
+            atlas_cursor = point( 0, atlas_cursor.y + height + 1 );
+        }
+        if( surface->w > atlas_size ) {
+            dbg( D_ERROR ) << "Glyph for " << ch << " does not fit into the font atlas";
+        } else if( atlas_cursor.y + surface->h <= atlas_size || add_atlas_page( renderer ) ) {
+            const SDL_Rect rect{ atlas_cursor.x, atlas_cursor.y, surface->w, surface->h };
+            if( !printErrorIf( SDL_UpdateTexture( atlas.back().texture.get(), &rect,
+                                                  surface->pixels, surface->pitch ) != 0,
+                               "SDL_UpdateTexture failed" ) ) {
+                glyph = glyph_t{ static_cast<int>( atlas.size() ) - 1, rect };
+            }
+            atlas_cursor.x += surface->w + 1;
+        }
     }
+    return glyph_cache_map.emplace( ch, glyph ).first->second;
+}
 
-    return CreateTextureFromSurface( renderer, sglyph );
+void CachedTTFFont::draw_glyph( const SDL_Renderer_Ptr &renderer, const queued_glyph &glyph )
+{
+    atlas_page &page = atlas[glyph.page];
+    if( page.mod.r != glyph.mod.r || page.mod.g != glyph.mod.g || page.mod.b != glyph.mod.b ) {
+        SetTextureColorMod( page.texture, glyph.mod.r, glyph.mod.g, glyph.mod.b );
+    }
+    if( page.mod.a != glyph.mod.a ) {
+        SDL_SetTextureAlphaMod( page.texture.get(), glyph.mod.a );
+    }
+    page.mod = glyph.mod;
+    RenderCopy( renderer, page.texture, &glyph.src, &glyph.dst );
 }
 
 bool CachedTTFFont::isGlyphProvided( const std::string &ch ) const
@@ -340,30 +422,50 @@ void CachedTTFFont::OutputChar( const SDL_Renderer_Ptr &renderer, const Geometry
                                 const std::string &ch, const point &p,
                                 unsigned char color, const float opacity )
 {
-    key_t    key {ch, static_cast<unsigned char>( color & 0xf )};
-
-    auto it = glyph_cache_map.find( key );
-    if( it == std::end( glyph_cache_map ) ) {
-        cached_t new_entry {
-            create_glyph( renderer, key.codepoints, key.color ),
-            static_cast<int>( width * utf8_wrapper( key.codepoints ).display_width() )
-        };
-        it = glyph_cache_map.insert( std::make_pair( std::move( key ), std::move( new_entry ) ) ).first;
-    }
-    const cached_t &value = it->second;
-
-    if( !value.texture ) {
+    const glyph_t &glyph = get_glyph( renderer, ch );
+    if( glyph.page < 0 ) {
         // Nothing we can do here )-:
         return;
     }
-    SDL_Rect rect {p.x, p.y, value.width, height};
-    if( opacity != 1.0f ) {
-        SDL_SetTextureAlphaMod( value.texture.get(), opacity * 255.0f );
+    const SDL_Color &tint = windowsPalette[color & 0xf];
+    const queued_glyph queued{
+        glyph.page,
+        SDL_Color{ tint.r, tint.g, tint.b, static_cast<Uint8>( opacity * 255.0f ) },
+        glyph.rect,
+        SDL_Rect{ p.x, p.y, glyph.rect.w, height }
+    };
+    if( batching ) {
+        queued_glyphs.push_back( queued );
+    } else {
+        draw_glyph( renderer, queued );
     }
-    RenderCopy( renderer, value.texture, nullptr, &rect );
-    if( opacity != 1.0f ) {
-        SDL_SetTextureAlphaMod( value.texture.get(), 255 );
+}
+
+void CachedTTFFont::begin_batch()
+{
+    batching = true;
+}
+
+void CachedTTFFont::end_batch( const SDL_Renderer_Ptr &renderer )
+{
+    batching = false;
+    // Glyphs in a batch don't overlap, so they can be drawn in any order. Group them by
+    // texture and color to change the texture state as rarely as possible.
+    const auto mod_key = []( const SDL_Color & c ) {
+        return static_cast<Uint32>( c.r ) << 24 | static_cast<Uint32>( c.g ) << 16 |
+               static_cast<Uint32>( c.b ) << 8 | c.a;
+    };
+    std::stable_sort( queued_glyphs.begin(), queued_glyphs.end(),
+    [&mod_key]( const queued_glyph & lhs, const queued_glyph & rhs ) {
+        if( lhs.page != rhs.page ) {
+            return lhs.page < rhs.page;
+        }
+        return mod_key( lhs.mod ) < mod_key( rhs.mod );
+    } );
+    for( const queued_glyph &glyph : queued_glyphs ) {
+        draw_glyph( renderer, glyph );
     }
+    queued_glyphs.clear();
 }
 
 BitmapFont::BitmapFont(
@@ -602,4 +704,18 @@ void FontFallbackList::OutputChar( const SDL_Renderer_Ptr &renderer,
     ( *cached->second )->OutputChar( renderer, geometry, ch, p, color, opacity );
 }
 
+void FontFallbackList::begin_batch()
+{
+    for( std::unique_ptr<Font> &font : fonts ) {
+        font->begin_batch();
+    }
+}
+
+void FontFallbackList::end_batch( const SDL_Renderer_Ptr &renderer )
+{
+    for( std::unique_ptr<Font> &font : fonts ) {
+        font->end_batch( renderer );
+    }
+}
+
 #endif // TILES
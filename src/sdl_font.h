@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 #include "sdl_geometry.h"
 #include "color.h"
@@ -19,7 +20,6 @@
 #include "debug.h"
 #include "font_loader.h"
 #include "point.h"
-#include "hash_utils.h"
 #include "sdl_wrappers.h"
 
 using palette_array = std::array<SDL_Color, color_loader<SDL_Color>::COLOR_NAMES_COUNT>;
@@ -44,6 +44,11 @@ class Font
                                  const std::string &ch, const point &p,
                                  unsigned char color, float opacity = 1.0f ) = 0;
 
+        /// Characters drawn between these calls may be queued and drawn together at the end,
+        /// so they must not overlap each other. Nothing else may be drawn over them in between.
+        virtual void begin_batch() {}
+        virtual void end_batch( const SDL_Renderer_Ptr & ) {}
+
         /// Draw an ascii line using font's palette.
         /// @param line_id Character to draw
         /// @param point Point on the screen where to draw character
@@ -69,7 +74,8 @@ class Font
 };
 using Font_Ptr = std::unique_ptr<Font>;
 
-/// Font implementation on a TrueType font. Its glyphs are cached.
+/// Font implementation on a TrueType font. Its glyphs are rendered once in white and
+/// packed into a few large textures, which are tinted to the requested color when drawing.
 class CachedTTFFont : public Font
 {
     public:
@@ -84,37 +90,41 @@ class CachedTTFFont : public Font
                          const std::string &ch,
                          const point &p,
                          unsigned char color, float opacity = 1.0f ) override;
+        void begin_batch() override;
+        void end_batch( const SDL_Renderer_Ptr &renderer ) override;
     protected:
-        SDL_Texture_Ptr create_glyph( const SDL_Renderer_Ptr &renderer, const std::string &ch, int color );
-
-        TTF_Font_Ptr font;
-        // Maps (character code, color) to SDL_Texture*
-
-        struct key_t {
-            std::string   codepoints;
-            unsigned char color;
-
-            std::pair<std::string, unsigned char> as_pair() const {
-                return std::make_pair( codepoints, color );
-            }
-
-            friend bool operator==( const key_t &lhs, const key_t &rhs ) noexcept {
-                return lhs.as_pair() == rhs.as_pair();
-            }
+        // A texture glyphs are packed into, in rows of the font height.
+        struct atlas_page {
+            SDL_Texture_Ptr texture;
+            // current color and alpha modulation of the texture
+            SDL_Color mod;
         };
-
-        struct key_t_hash {
-            size_t operator()( const key_t &k ) const {
-                return cata::auto_hash<std::pair<std::string, unsigned char>>()( k.as_pair() );
-            }
+        // Where a glyph is in the atlas, page is negative if it could not be rendered.
+        struct glyph_t {
+            int page;
+            SDL_Rect rect;
         };
-
-        struct cached_t {
-            SDL_Texture_Ptr texture;
-            int          width;
+        struct queued_glyph {
+            int page;
+            SDL_Color mod;
+            SDL_Rect src;
+            SDL_Rect dst;
         };
 
-        std::unordered_map<key_t, cached_t, key_t_hash> glyph_cache_map;
+        SDL_Surface_Ptr create_glyph( const std::string &ch );
+        const glyph_t &get_glyph( const SDL_Renderer_Ptr &renderer, const std::string &ch );
+        bool add_atlas_page( const SDL_Renderer_Ptr &renderer );
+        void draw_glyph( const SDL_Renderer_Ptr &renderer, const queued_glyph &glyph );
+
+        TTF_Font_Ptr font;
+        std::vector<atlas_page> atlas;
+        // where the next glyph goes on the last page
+        point atlas_cursor;
+        int atlas_size = 0;
+        // Maps character codes to their place in the atlas
+        std::unordered_map<std::string, glyph_t> glyph_cache_map;
+        bool batching = false;
+        std::vector<queued_glyph> queued_glyphs;
 
         const bool fontblending;
 };
@@ -164,6 +174,8 @@ class FontFallbackList : public Font
                          const std::string &ch,
                          const point &p,
                          unsigned char color, float opacity = 1.0f ) override;
+        void begin_batch() override;
+        void end_batch( const SDL_Renderer_Ptr &renderer ) override;
     protected:
         std::vector<std::unique_ptr<Font>> fonts;
         std::map<std::string, std::vector<std::unique_ptr<Font>>::iterator> glyph_font;
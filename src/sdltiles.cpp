@@ -578,6 +578,12 @@ void set_displaybuffer_rendertarget()
     SetRenderTarget( renderer, display_buffer );
 }
 
+//for copying the rendered terrain view into the frame cache in cata_tiles.cpp
+const SDL_Texture_Ptr &get_displaybuffer()
+{
+    return display_buffer;
+}
+
 static void invalidate_framebuffer( std::vector<curseline> &framebuffer, const point &p, int width,
                                     int height )
 {
@@ -1103,10 +1109,9 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
         }
     }
 
-    // TODO: Get this from UTF system to make sure it is exactly the kind of space we need
-    static const std::string space_string = " ";
-
     bool update = false;
+    // Cells don't overlap, so their text can be drawn after all the backgrounds.
+    font->begin_batch();
     for( int j = 0; j < win->height; j++ ) {
         if( !win->line[j].touched ) {
             continue;
@@ -1118,8 +1123,19 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
             break;
         }
 
-        update = true;
         win->line[j].touched = false;
+        // Rows that were only rewritten with the same content don't need to be drawn again.
+        const std::vector<cursecell> &row = win->line[j].chars;
+        const std::vector<cursecell> &framebuffer_row = framebuffer[fby].chars;
+        if( oldWinCompatible && fontScale == fontScaleBuffer &&
+            win->pos.x < static_cast<int>( framebuffer_row.size() ) ) {
+            const int visible = std::min<int>( win->width, framebuffer_row.size() - win->pos.x );
+            if( std::equal( row.begin(), row.begin() + visible,
+                            framebuffer_row.begin() + win->pos.x ) ) {
+                continue;
+            }
+        }
+        update = true;
         for( int i = 0; i < win->width; i++ ) {
             const int fbx = win->pos.x + i;
             if( fbx >= static_cast<int>( framebuffer[fby].chars.size() ) ) {
@@ -1149,20 +1165,21 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
             }
 
             // Spaces are used a lot, so this does help noticeably
-            if( cell.ch == space_string ) {
+            if( cell.ch.is_space() ) {
                 geometry->rect( renderer, draw, font->width, font->height,
                                 color_as_sdl( cell.BG ) );
                 continue;
             }
-            const int codepoint = UTF8_getch( cell.ch );
+            const int codepoint = cell.ch.codepoint();
             const catacurses::base_color FG = cell.FG;
             const catacurses::base_color BG = cell.BG;
-            int cw = ( codepoint == UNKNOWN_UNICODE ) ? 1 : utf8_width( cell.ch );
+            int cw = ( codepoint == UNKNOWN_UNICODE ) ? 1 : utf8_width( cell.ch.str() );
             if( cw < 1 ) {
                 // utf8_width() may return a negative width
                 continue;
             }
-            bool use_draw_ascii_lines_routine = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
+            static const option_handle<bool> draw_ascii_lines_option( "USE_DRAW_ASCII_LINES_ROUTINE" );
+            bool use_draw_ascii_lines_routine = draw_ascii_lines_option.get();
             unsigned char uc = static_cast<unsigned char>( cell.ch[0] );
             switch( codepoint ) {
                 case LINE_XOXO_UNICODE:
@@ -1210,10 +1227,11 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
             if( use_draw_ascii_lines_routine ) {
                 font->draw_ascii_lines( renderer, geometry, uc, draw, FG );
             } else {
-                font->OutputChar( renderer, geometry, cell.ch, draw, FG );
+                font->OutputChar( renderer, geometry, cell.ch.str(), draw, FG );
             }
         }
     }
+    font->end_batch( renderer );
     win->draw = false; //We drew the window, mark it as so
     //Keeping track of last drawn window and tilemode zoom level
     ::winBuffer = w.weak_ptr();
@@ -77,6 +77,19 @@ void event_summary::deserialize( JsonIn &jsin )
     jo.read( "last", last, true );
 }
 
+event_multiset::event_multiset( const event_multiset &other )
+    : type_( other.type_ )
+    , summaries_( other.summaries_ )
+{}
+
+event_multiset &event_multiset::operator=( const event_multiset &other )
+{
+    type_ = other.type_;
+    summaries_ = other.summaries_;
+    summaries_by_values_.clear();
+    return *this;
+}
+
 void event_multiset::set_type( event_type type )
 {
     // Used during stats_tracker deserialization to set the type
@@ -186,7 +199,16 @@ cata::optional<event_multiset::summaries_type::value_type> event_multiset::last(
 
 void event_multiset::add( const cata::event &e )
 {
-    summaries_[e.data()].add( e );
+    const cata::event::values_type *values = e.values();
+    if( values == nullptr ) {
+        summaries_[e.data()].add( e );
+        return;
+    }
+    auto found = summaries_by_values_.find( *values );
+    if( found == summaries_by_values_.end() ) {
+        found = summaries_by_values_.emplace( *values, &summaries_[e.data()] ).first;
+    }
+    found->second->add( e );
 }
 
 void event_multiset::add( const summaries_type::value_type &e )
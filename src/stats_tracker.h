@@ -63,6 +63,10 @@ class event_multiset
         // type
         event_multiset() : type_( event_type::num_event_types ) {}
         explicit event_multiset( event_type type ) : type_( type ) {}
+        event_multiset( const event_multiset & );
+        event_multiset( event_multiset && ) = default;
+        event_multiset &operator=( const event_multiset & );
+        event_multiset &operator=( event_multiset && ) = default;
 
         void set_type( event_type );
 
@@ -101,6 +105,11 @@ class event_multiset
     private:
         event_type type_;
         summaries_type summaries_;
+        // The summary of the events with each set of inline values, so adding an
+        // event does not need its data map, see cata::event::values.  It points
+        // into summaries_ and is not copied with it.
+        std::unordered_map<cata::event::values_type, event_summary *, cata::range_hash>
+        summaries_by_values_;
 };
 
 class base_watcher
@@ -956,7 +956,7 @@ void Character::suffer_from_item_dropping()
                 tumble_items.push_back( *dump_item );
             }
         }
-        put_into_vehicle_or_drop( *this, item_drop_reason::tumbling, tumble_items );
+        put_into_vehicle_or_drop( *this, item_drop_reason::tumbling, std::move( tumble_items ) );
         for( item *i : dump ) {
             i_rem( i );
         }
@@ -15,17 +15,21 @@ void temp_crafting_inventory::clear()
 {
     items.clear();
     temp_owned_items.clear();
+    binned = false;
+    binned_items.clear();
 }
 
 void temp_crafting_inventory::add_item_ref( item &item )
 {
     items.insert( &item );
+    binned = false;
 }
 
 item &temp_crafting_inventory::add_item_copy( const item &item )
 {
     const auto iter = temp_owned_items.insert( item );
     items.insert( &( *iter ) );
+    binned = false;
     return *iter;
 }
 
@@ -36,3 +40,36 @@ void temp_crafting_inventory::add_all_ref( const read_only_visitable &v )
         return VisitResponse::SKIP;
     } );
 }
+
+int temp_crafting_inventory::count_item( const itype_id &item_type ) const
+{
+    const itype_bin &bin = get_binned_items();
+    const auto iter = bin.find( item_type );
+    if( iter == bin.end() ) {
+        return 0;
+    }
+    int num = 0;
+    for( const item *it : iter->second ) {
+        num += it->count();
+    }
+    return num;
+}
+
+const temp_crafting_inventory::itype_bin &temp_crafting_inventory::get_binned_items() const
+{
+    if( binned ) {
+        return binned_items;
+    }
+
+    binned_items.clear();
+    visit_items( [this]( item * e, item * ) {
+        binned_items[e->typeId()].push_back( e );
+        for( const item *it : e->softwares() ) {
+            binned_items[it->typeId()].push_back( it );
+        }
+        return VisitResponse::NEXT;
+    } );
+
+    binned = true;
+    return binned_items;
+}
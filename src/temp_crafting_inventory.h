@@ -2,11 +2,15 @@
 #ifndef CATA_SRC_TEMP_CRAFTING_INVENTORY_H
 #define CATA_SRC_TEMP_CRAFTING_INVENTORY_H
 
+#include <climits>
 #include <cstddef>
 #include <functional>
+#include <unordered_map>
+#include <vector>
 
 #include "colony.h"
 #include "item.h"
+#include "type_id.h"
 #include "visitable.h"
 
 /**
@@ -42,15 +46,31 @@ class temp_crafting_inventory : public read_only_visitable
         */
         item &add_item_copy( const item &item );
 
+        /** Number of items of the given type, items counted by charges count each charge */
+        int count_item( const itype_id &item_type ) const;
+
         // inherited from visitable
         VisitResponse visit_items( const std::function<VisitResponse( item *, item * )> &func ) const
         override;
+        int charges_of( const itype_id &what, int limit = INT_MAX,
+                        const std::function<bool( const item & )> &filter = return_true<item>,
+                        const std::function<void( int )> &visitor = nullptr ) const override;
+        int amount_of( const itype_id &what, bool pseudo = true, int limit = INT_MAX,
+                       const std::function<bool( const item & )> &filter = return_true<item> ) const
+        override;
+
+        using itype_bin = std::unordered_map<itype_id, std::vector<const item *>>;
+        /** All items of this container, including contained ones, grouped by type */
+        const itype_bin &get_binned_items() const;
 
     private:
         // list of all items in this container
         cata::colony<item *> items;
         // copies of "owned" items added by `add_item_copy`
         cata::colony<item> temp_owned_items;
+
+        mutable bool binned = false;
+        mutable itype_bin binned_items;
 };
 
 #endif // CATA_SRC_TEMP_CRAFTING_INVENTORY_H
@@ -3414,7 +3414,7 @@ void veh_interact::complete_vehicle( player &p )
             // Finally, put all the results somewhere (we wanted to wait until this
             // point because we don't want to put them back into the vehicle part
             // that just got removed).
-            put_into_vehicle_or_drop( p, item_drop_reason::deliberate, resulting_items );
+            put_into_vehicle_or_drop( p, item_drop_reason::deliberate, std::move( resulting_items ) );
             break;
         }
     }
@@ -280,7 +280,12 @@ vehicle::vehicle() : vehicle( vproto_id() )
     sm_pos = tripoint_zero;
 }
 
-vehicle::~vehicle() = default;
+vehicle::~vehicle()
+{
+    if( !loose_parts.empty() ) {
+        invalidate_power_grids();
+    }
+}
 
 bool vehicle::player_in_control( const Character &p ) const
 {
@@ -3157,24 +3162,59 @@ void vehicle::precalc_mounts( int idir, const units::angle &dir, const point &pi
     if( idir < 0 || idir > 1 ) {
         idir = 0;
     }
+    if( movement_parts.part_mount.size() != parts.size() ) {
+        // parts were added while refreshing was suppressed
+        rebuild_movement_cache();
+    }
     tileray tdir( dir );
-    std::unordered_map<point, tripoint> mount_to_precalc;
-    for( vehicle_part &p : parts ) {
-        if( p.removed ) {
+    // all parts on a mount point share the precalculated position of the first one,
+    // translating keeps the z offset it has on ramps
+    std::vector<const tripoint *> mount_precalc( movement_parts.mounts.size(), nullptr );
+    for( size_t p = 0; p < parts.size(); p++ ) {
+        const int m = movement_parts.part_mount[p];
+        if( m < 0 || parts[p].removed ) {
             continue;
         }
-        auto q = mount_to_precalc.find( p.mount );
-        if( q == mount_to_precalc.end() ) {
-            coord_translate( tdir, pivot, p.mount, p.precalc[idir] );
-            mount_to_precalc.insert( { p.mount, p.precalc[idir] } );
+        tripoint &precalc = parts[p].precalc[idir];
+        if( mount_precalc[m] == nullptr ) {
+            coord_translate( tdir, pivot, movement_parts.mounts[m], precalc );
+            mount_precalc[m] = &precalc;
         } else {
-            p.precalc[idir] = q->second;
+            precalc = *mount_precalc[m];
         }
     }
     pivot_anchor[idir] = pivot;
     pivot_rotation[idir] = dir;
 }
 
+void vehicle::rebuild_movement_cache()
+{
+    movement_cache &cache = movement_parts;
+    cache.mounts.clear();
+    cache.part_mount.assign( parts.size(), -1 );
+    cache.colliders.clear();
+    cache.collider_rotor_radius.clear();
+    std::unordered_map<point, int> mount_index;
+    for( size_t p = 0; p < parts.size(); p++ ) {
+        const vehicle_part &vp = parts[p];
+        if( vp.removed ) {
+            continue;
+        }
+        const auto inserted = mount_index.emplace( vp.mount, static_cast<int>( cache.mounts.size() ) );
+        if( inserted.second ) {
+            cache.mounts.push_back( vp.mount );
+        }
+        cache.part_mount[p] = inserted.first->second;
+
+        const vpart_info &info = vp.info();
+        const int rotor_diameter = info.rotor_diameter();
+        if( info.location == part_location_structure || rotor_diameter != 0 ) {
+            cache.colliders.push_back( static_cast<int>( p ) );
+            cache.collider_rotor_radius.push_back( static_cast<int>( std::round( rotor_diameter / 2.0f ) ) );
+        }
+    }
+}
+
 std::vector<int> vehicle::boarded_parts() const
 {
     std::vector<int> res;
@@ -5047,60 +5087,71 @@ void vehicle::enumerate_vehicles( std::map<vehicle *, bool> &connected_vehicles,
     }
 }
 
-template <typename Func, typename Vehicle>
-int vehicle::traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action )
-{
-    if( start_veh->loose_parts.empty() ) {
-        return amount;
-    }
-    // Breadth-first search! Initialize the queue with a pointer to ourselves and go!
-    std::queue< std::pair<Vehicle *, int> > connected_vehs;
-    std::set<Vehicle *> visited_vehs;
-    connected_vehs.push( std::make_pair( start_veh, 0 ) );
+std::int64_t vehicle::power_grid_generation = 0;
 
-    while( amount > 0 && !connected_vehs.empty() ) {
-        auto current_node = connected_vehs.front();
-        Vehicle *current_veh = current_node.first;
-        int current_loss = current_node.second;
+void vehicle::invalidate_power_grids()
+{
+    power_grid_generation++;
+}
 
-        visited_vehs.insert( current_veh );
-        connected_vehs.pop();
+const std::vector<power_grid_node> &vehicle::power_grid() const
+{
+    if( power_grid_cache_owner == this && power_grid_cache_generation == power_grid_generation ) {
+        return power_grid_cache;
+    }
+    power_grid_cache.clear();
+    if( !loose_parts.empty() ) {
+        // Breadth-first search! Initialize the queue with a pointer to ourselves and go!
+        std::queue<std::pair<const vehicle *, int>> connected_vehs;
+        std::set<const vehicle *> visited_vehs = { this };
+        connected_vehs.push( std::make_pair( this, 0 ) );
 
-        add_msg_debug( debugmode::DF_VEHICLE, "Traversing graph with %d power", amount );
+        while( !connected_vehs.empty() ) {
+            const vehicle *current_veh = connected_vehs.front().first;
+            const int current_loss = connected_vehs.front().second;
+            connected_vehs.pop();
 
-        for( int p : current_veh->loose_parts ) {
-            if( !current_veh->part_info( p ).has_flag( "POWER_TRANSFER" ) ) {
-                continue; // ignore loose parts that aren't power transfer cables
-            }
+            for( int p : current_veh->loose_parts ) {
+                if( !current_veh->part_info( p ).has_flag( "POWER_TRANSFER" ) ) {
+                    continue; // ignore loose parts that aren't power transfer cables
+                }
 
-            vehicle *target_veh = vehicle::find_vehicle( current_veh->parts[p].target.second );
-            if( target_veh == nullptr || visited_vehs.count( target_veh ) > 0 ) {
-                // Either no destination here (that vehicle's rolled away or off-map) or
-                // we've already looked at that vehicle.
-                continue;
-            }
+                vehicle *target_veh = vehicle::find_vehicle( current_veh->parts[p].target.second );
+                if( target_veh == nullptr || !visited_vehs.insert( target_veh ).second ) {
+                    // Either no destination here (that vehicle's rolled away or off-map) or
+                    // we've already looked at that vehicle.
+                    continue;
+                }
 
-            // Add this connected vehicle to the queue of vehicles to search next,
-            // but only if we haven't seen this one before.
-            if( visited_vehs.count( target_veh ) < 1 ) {
-                int target_loss = current_loss + current_veh->part_info( p ).epower;
+                const int target_loss = current_loss + current_veh->part_info( p ).epower;
                 connected_vehs.push( std::make_pair( target_veh, target_loss ) );
-
-                float loss_amount = ( static_cast<float>( amount ) * static_cast<float>( target_loss ) ) / 100.0f;
-                add_msg_debug( debugmode::DF_VEHICLE,
-                               "Visiting remote %p with %d power (loss %f, which is %d percent)",
-                               static_cast<void *>( target_veh ), amount, loss_amount, target_loss );
-
-                amount = action( target_veh, amount, static_cast<int>( loss_amount ) );
-                add_msg_debug( debugmode::DF_VEHICLE, "After remote %p, %d power",
-                               static_cast<void *>( target_veh ), amount );
-
-                if( amount < 1 ) {
-                    break; // No more charge to donate away.
-                }
+                power_grid_cache.push_back( { target_veh, target_loss } );
             }
         }
     }
+    // Looking up remote vehicles may have loaded submaps, which invalidates the grids again.
+    // The vehicles found here are loaded now, so the grid is still correct.
+    power_grid_cache_generation = power_grid_generation;
+    power_grid_cache_owner = this;
+    return power_grid_cache;
+}
+
+template <typename Func, typename Vehicle>
+int vehicle::traverse_vehicle_graph( Vehicle *start_veh, int amount, Func action )
+{
+    for( const power_grid_node &node : start_veh->power_grid() ) {
+        if( amount < 1 ) {
+            break; // No more charge to donate away.
+        }
+        float loss_amount = ( static_cast<float>( amount ) * static_cast<float>( node.loss ) ) / 100.0f;
+        add_msg_debug( debugmode::DF_VEHICLE,
+                       "Visiting remote %p with %d power (loss %f, which is %d percent)",
+                       static_cast<void *>( node.veh ), amount, loss_amount, node.loss );
+
+        amount = action( node.veh, amount, static_cast<int>( loss_amount ) );
+        add_msg_debug( debugmode::DF_VEHICLE, "After remote %p, %d power",
+                       static_cast<void *>( node.veh ), amount );
+    }
     return amount;
 }
 
@@ -5358,7 +5409,7 @@ int vehicle::add_charges( int part, const item &itm )
 
     item itm_copy = itm;
     itm_copy.charges = ret;
-    return add_item( part, itm_copy ) ? ret : 0;
+    return add_item_by_move( part, itm_copy ) ? ret : 0;
 }
 
 cata::optional<vehicle_stack::iterator> vehicle::add_item( vehicle_part &pt, const item &obj )
@@ -5371,7 +5422,8 @@ cata::optional<vehicle_stack::iterator> vehicle::add_item( vehicle_part &pt, con
     return add_item( idx, obj );
 }
 
-cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item &itm )
+template<typename Item>
+cata::optional<vehicle_stack::iterator> vehicle::add_item_internal( int part, Item &&itm )
 {
     if( part < 0 || part >= static_cast<int>( parts.size() ) ) {
         debugmsg( "int part (%d) is out of range", part );
@@ -5407,7 +5459,8 @@ cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item
         }
     }
 
-    item itm_copy = itm;
+    // Copied if the caller keeps the item, moved otherwise
+    item itm_copy = std::forward<Item>( itm );
 
     if( itm_copy.is_bucket_nonempty() ) {
         // this is a vehicle, so there is only one pocket.
@@ -5415,8 +5468,8 @@ cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item
         itm_copy.contents.spill_contents( global_part_pos3( part ) );
     }
 
-    const vehicle_stack::iterator new_pos = p.items.insert( itm_copy );
-    if( itm_copy.needs_processing() ) {
+    const vehicle_stack::iterator new_pos = p.items.insert( std::move( itm_copy ) );
+    if( new_pos->needs_processing() ) {
         active_items.add( *new_pos, p.mount );
     }
 
@@ -5424,6 +5477,16 @@ cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item
     return cata::optional<vehicle_stack::iterator>( new_pos );
 }
 
+cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item &itm )
+{
+    return add_item_internal( part, itm );
+}
+
+cata::optional<vehicle_stack::iterator> vehicle::add_item_by_move( int part, item &itm )
+{
+    return add_item_internal( part, std::move( itm ) );
+}
+
 bool vehicle::remove_item( int part, item *it )
 {
     const cata::colony<item> &veh_items = parts[part].items;
@@ -5435,6 +5498,19 @@ bool vehicle::remove_item( int part, item *it )
     return true;
 }
 
+item vehicle::take_item( int part, item *it )
+{
+    const cata::colony<item> &veh_items = parts[part].items;
+    const cata::colony<item>::const_iterator iter = veh_items.get_iterator_from_pointer( it );
+    if( iter == veh_items.end() ) {
+        debugmsg( "Tried to take an item that is not in the cargo of part %d", part );
+        return item();
+    }
+    item taken = std::move( *it );
+    remove_item( part, iter );
+    return taken;
+}
+
 vehicle_stack::iterator vehicle::remove_item( int part, const vehicle_stack::const_iterator &it )
 {
     cata::colony<item> &veh_items = parts[part].items;
@@ -5659,6 +5735,10 @@ void vehicle::refresh()
     if( no_refresh ) {
         return;
     }
+    if( !loose_parts.empty() ) {
+        // cables may have been added or removed
+        invalidate_power_grids();
+    }
 
     alternators.clear();
     engines.clear();
@@ -5840,6 +5920,10 @@ void vehicle::refresh()
         }
     }
 
+    if( !loose_parts.empty() ) {
+        invalidate_power_grids();
+    }
+
     rail_wheel_bounding_box.p1 = point( railwheel_xmin, railwheel_ymin );
     rail_wheel_bounding_box.p2 = point( railwheel_xmax, railwheel_ymax );
     front_left.x = mount_max.x;
@@ -5852,6 +5936,7 @@ void vehicle::refresh()
         rail_wheel_bounding_box.p2 = point_zero;
     }
 
+    rebuild_movement_cache();
     // NB: using the _old_ pivot point, don't recalc here, we only do that when moving!
     precalc_mounts( 0, pivot_rotation[0], pivot_anchor[0] );
     check_environmental_effects = true;
@@ -7008,8 +7093,9 @@ void vehicle::update_time( const time_point &update_to )
         return;
     }
     // Get one weather data set per vehicle, they don't differ much across vehicle area
-    const weather_sum accum_weather = sum_conditions( update_from, update_to,
-                                      here.getabs( global_pos3() ) );
+    // Wind turbines and water wheels don't depend on the past weather, so skip it for them
+    const weather_sum accum_weather = funnels.empty() && solar_panels.empty() ? weather_sum() :
+                                      sum_conditions( update_from, update_to, here.getabs( global_pos3() ) );
     // make some reference objects to use to check for reload
     const item water( "water" );
     const item water_clean( "water_clean" );
@@ -5,6 +5,7 @@
 #include <array>
 #include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <list>
@@ -188,6 +189,13 @@ class towing_data
         tripoint other_towing_point;
 };
 
+/** A vehicle connected to another one through power cables */
+struct power_grid_node {
+    vehicle *veh;
+    // Accumulated loss of the cables on the way to the vehicle, in percent
+    int loss;
+};
+
 struct bounding_box {
     point p1;
     point p2;
@@ -1436,6 +1444,16 @@ class vehicle
          */
         static void enumerate_vehicles( std::map<vehicle *, bool> &connected_vehicles,
                                         std::set<vehicle *> &vehicle_list );
+        /**
+         * Vehicles connected to this one by POWER_TRANSFER parts, in breadth-first order,
+         * excluding this vehicle. The grid is cached until @ref invalidate_power_grids is called.
+         */
+        const std::vector<power_grid_node> &power_grid() const;
+        /**
+         * Drops the cached power grids of all vehicles. Needs to be called when power cables
+         * change, a vehicle with cables is destroyed, or a submap that may contain one is loaded.
+         */
+        static void invalidate_power_grids();
         // idle fuel consumption
         void idle( bool on_map = true );
         // continuous processing for running vehicle alarms
@@ -1518,6 +1536,11 @@ class vehicle
          * Otherwise, returns an iterator to the added item in the vehicle stack
          */
         cata::optional<vehicle_stack::iterator> add_item( int part, const item &itm );
+        /**
+         * Like the above, but moves the item into the cargo instead of copying it. The item is
+         * only moved from if it was added.
+         */
+        cata::optional<vehicle_stack::iterator> add_item_by_move( int part, item &itm );
         /** Like the above */
         cata::optional<vehicle_stack::iterator> add_item( vehicle_part &pt, const item &obj );
         /**
@@ -1530,6 +1553,8 @@ class vehicle
         // remove item from part's cargo
         bool remove_item( int part, item *it );
         vehicle_stack::iterator remove_item( int part, const vehicle_stack::const_iterator &it );
+        /** Removes the item from part's cargo and returns it, without copying it */
+        item take_item( int part, item *it );
 
         vehicle_stack get_items( int part ) const;
         vehicle_stack get_items( int part );
@@ -1609,6 +1634,9 @@ class vehicle
         int automatic_fire_turret( vehicle_part &pt );
 
     private:
+        template<typename Item>
+        cata::optional<vehicle_stack::iterator> add_item_internal( int part, Item &&itm );
+
         /*
          * Find all turrets that are ready to fire.
          * @param manual Include turrets set to 'manual' targeting mode
@@ -1989,6 +2017,30 @@ class vehicle
     private:
         bool no_refresh = false;
 
+        /**
+         * Compact copy of the part data needed to move the vehicle, so turning and collision
+         * checks don't have to walk the large vehicle_part objects. Rebuilt by @ref refresh.
+         */
+        struct movement_cache {
+            // distinct mount points of the parts that aren't removed
+            std::vector<point> mounts;
+            // index into mounts for each part, -1 for removed parts
+            std::vector<int> part_mount;
+            // parts that can collide with things: structure parts and rotors
+            std::vector<int> colliders;
+            // radius swept by each of the colliders, 0 if it's no rotor
+            std::vector<int> collider_rotor_radius;
+        };
+        movement_cache movement_parts;
+        void rebuild_movement_cache();
+
+        // incremented by invalidate_power_grids
+        static std::int64_t power_grid_generation;
+        mutable std::vector<power_grid_node> power_grid_cache;
+        mutable std::int64_t power_grid_cache_generation = -1;
+        // vehicle the cache was built for, copies of a vehicle don't share its grid
+        mutable const vehicle *power_grid_cache_owner = nullptr;
+
         // if true, pivot_cache needs to be recalculated
         mutable bool pivot_dirty = true;
         mutable bool mass_dirty = true;
@@ -680,10 +680,14 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
     const int sign_before = sgn( velocity_before );
     bool empty = true;
     map &here = get_map();
-    for( int p = 0; static_cast<size_t>( p ) < parts.size(); p++ ) {
-        const vpart_info &info = part_info( p );
-        if( ( info.location != part_location_structure && info.rotor_diameter() == 0 ) ||
-            parts[ p ].removed ) {
+    if( movement_parts.part_mount.size() != parts.size() ) {
+        // parts were added while refreshing was suppressed
+        rebuild_movement_cache();
+    }
+    // only structure parts and rotors can collide
+    for( size_t c = 0; c < movement_parts.colliders.size(); c++ ) {
+        const int p = movement_parts.colliders[c];
+        if( parts[ p ].removed ) {
             continue;
         }
         empty = false;
@@ -691,8 +695,9 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
         //  and turning (precalc[1])
         const tripoint dsp = global_pos3() + dp + parts[p].precalc[1];
         veh_collision coll = part_collision( p, dsp, just_detect, bash_floor );
-        if( coll.type == veh_coll_nothing && info.rotor_diameter() > 0 ) {
-            size_t radius = static_cast<size_t>( std::round( info.rotor_diameter() / 2.0f ) );
+        const int rotor_radius = movement_parts.collider_rotor_radius[c];
+        if( coll.type == veh_coll_nothing && rotor_radius > 0 ) {
+            size_t radius = static_cast<size_t>( rotor_radius );
             for( const tripoint &rotor_point : here.points_in_radius( dsp, radius ) ) {
                 veh_collision rotor_coll = part_collision( p, rotor_point, just_detect, false );
                 if( rotor_coll.type != veh_coll_nothing ) {
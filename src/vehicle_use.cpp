@@ -9,6 +9,7 @@
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <utility>
 
 #include "action.h"
 #include "activity_actor_definitions.h"
@@ -49,6 +50,7 @@
 #include "sounds.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
+#include "temp_crafting_inventory.h"
 #include "translations.h"
 #include "ui.h"
 #include "units.h"
@@ -1231,7 +1233,8 @@ void vehicle::reload_seeds( const tripoint &pos )
             }
             used_seed.front().set_age( 0_turns );
             //place seeds into the planter
-            put_into_vehicle_or_drop( player_character, item_drop_reason::deliberate, used_seed, pos );
+            put_into_vehicle_or_drop( player_character, item_drop_reason::deliberate,
+                                      std::move( used_seed ), pos );
         }
     }
 }
@@ -2002,15 +2005,21 @@ void vehicle::validate_carried_vehicles( std::vector<std::vector<int>>
 }
 
 
-void vpart_position::form_inventory( inventory &inv )
+void vpart_position::form_inventory( inventory &inv, temp_crafting_inventory *refs )
 {
     const int veh_battery = vehicle().fuel_left( itype_id( "battery" ), true );
     const cata::optional<vpart_reference> vp_faucet = part_with_tool( itype_water_faucet );
     const cata::optional<vpart_reference> vp_cargo = part_with_feature( "CARGO", true );
 
     if( vp_cargo ) {
-        const vehicle_stack items = vehicle().get_items( vp_cargo->part_index() );
-        inv += std::list<item>( items.begin(), items.end() );
+        vehicle_stack items = vehicle().get_items( vp_cargo->part_index() );
+        if( refs ) {
+            for( item &it : items ) {
+                refs->add_item_ref( it );
+            }
+        } else {
+            inv += std::list<item>( items.begin(), items.end() );
+        }
     }
 
     // HACK: water_faucet pseudo tool gives access to liquids in tanks
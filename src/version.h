@@ -0,0 +1,2 @@
+// NOLINT(cata-header-guard)
+#define VERSION "a8c4f35"
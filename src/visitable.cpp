@@ -817,6 +817,33 @@ int inventory::charges_of( const itype_id &what, int limit,
     return std::min( limit, res );
 }
 
+/** @relates visitable */
+int temp_crafting_inventory::charges_of( const itype_id &what, int limit,
+        const std::function<bool( const item & )> &filter,
+        const std::function<void( int )> &visitor ) const
+{
+    if( what == itype_UPS ) {
+        int qty = 0;
+        qty = sum_no_wrap( qty, charges_of( itype_UPS_off ) );
+        qty = sum_no_wrap( qty, static_cast<int>( charges_of( itype_adv_UPS_off ) / 0.6 ) );
+        return std::min( qty, limit );
+    }
+    const itype_bin &binned = get_binned_items();
+    const auto iter = binned.find( what );
+    if( iter == binned.end() ) {
+        return 0;
+    }
+
+    int res = 0;
+    for( const item *it : iter->second ) {
+        res = sum_no_wrap( res, charges_of_internal( *it, *this, what, limit, filter, visitor ) );
+        if( res >= limit ) {
+            break;
+        }
+    }
+    return std::min( limit, res );
+}
+
 /** @relates visitable */
 int Character::charges_of( const itype_id &what, int limit,
                            const std::function<bool( const item & )> &filter,
@@ -898,6 +925,32 @@ int inventory::amount_of( const itype_id &what, bool pseudo, int limit,
     return std::min( limit, res );
 }
 
+/** @relates visitable */
+int temp_crafting_inventory::amount_of( const itype_id &what, bool pseudo, int limit,
+                                        const std::function<bool( const item & )> &filter ) const
+{
+    if( what == STATIC( itype_id( "any" ) ) ) {
+        return read_only_visitable::amount_of( what, pseudo, limit, filter );
+    }
+    const itype_bin &binned = get_binned_items();
+    const auto iter = binned.find( what );
+    if( iter == binned.end() ) {
+        return 0;
+    }
+
+    // The bin already contains nested items, so each entry only counts itself.
+    int res = 0;
+    for( const item *it : iter->second ) {
+        if( filter( *it ) && ( pseudo || !it->has_flag( STATIC( flag_id( "PSEUDO" ) ) ) ) ) {
+            res = sum_no_wrap( res, 1 );
+            if( res >= limit ) {
+                break;
+            }
+        }
+    }
+    return std::min( limit, res );
+}
+
 /** @relates visitable */
 int Character::amount_of( const itype_id &what, bool pseudo, int limit,
                           const std::function<bool( const item & )> &filter ) const
@@ -15,6 +15,7 @@
 
 class inventory;
 class player;
+class temp_crafting_inventory;
 class vehicle;
 class vpart_info;
 struct vehicle_part;
@@ -89,8 +90,8 @@ class vpart_position
         cata::optional<vpart_reference> part_with_tool( const itype_id &tool_type ) const;
         // Returns a list of all tools provided by vehicle and their hotkey
         std::vector<std::pair<itype_id, int>> get_tools() const;
-        // Forms inventory for inventory::form_from_map
-        void form_inventory( inventory &inv );
+        // Forms inventory for inventory::form_from_map, cargo items are referenced in refs if given
+        void form_inventory( inventory &inv, temp_crafting_inventory *refs = nullptr );
 
         /**
          * Returns the position of this part in the coordinates system that @ref game::m uses.
@@ -4,9 +4,11 @@
 #include <array>
 #include <cmath>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "activity_type.h"
@@ -165,21 +167,114 @@ static inline void proc_weather_sum( const weather_type_id &wtype, weather_sum &
 
 weather_type_id current_weather( const tripoint &location, const time_point &t )
 {
-    const weather_generator wgen = g->weather.get_cur_weather_gen();
-    if( g->weather.weather_override != WEATHER_NULL ) {
-        return g->weather.weather_override;
+    const weather_manager &weather = get_weather();
+    if( weather.weather_override != WEATHER_NULL ) {
+        return weather.weather_override;
+    }
+    return weather.get_cur_weather_gen().get_weather_conditions( location, t, g->get_seed() );
+}
+
+namespace
+{
+/** Weather of one overmap tile during one day, sampled once per hour */
+struct weather_day {
+    std::array<weather_sum, 24> hours;
+    weather_sum total;
+};
+
+/**
+ * Days of weather that have already been summed up. The weather only depends on the world
+ * seed, so the days can be shared by all vehicles and funnels on the same overmap tile.
+ */
+struct weather_timeline {
+    unsigned int seed = 0;
+    std::map<std::pair<tripoint_abs_omt, int>, weather_day> days;
+};
+} // namespace
+
+static weather_timeline past_weather;
+
+// Enough for a month of absence for a few dozen overmap tiles
+static constexpr size_t max_weather_timeline_days = 1024;
+
+static const weather_day &get_weather_day( const tripoint_abs_omt &omt, const int day )
+{
+    const unsigned int seed = g->get_seed();
+    if( past_weather.seed != seed || past_weather.days.size() >= max_weather_timeline_days ) {
+        past_weather.seed = seed;
+        past_weather.days.clear();
+    }
+    const auto iter = past_weather.days.find( std::make_pair( omt, day ) );
+    if( iter != past_weather.days.end() ) {
+        return iter->second;
+    }
+
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    const tripoint location = project_to<coords::ms>( omt ).raw();
+    const time_point day_start = calendar::turn_zero + 1_days * day;
+    weather_day &result = past_weather.days[std::make_pair( omt, day )];
+    for( int hour = 0; hour < 24; ++hour ) {
+        const time_point hour_start = day_start + 1_hours * hour;
+        const weather_type_id wtype = wgen.get_weather_conditions( location, hour_start, seed );
+        // the weather is sampled hourly, but the sunlight changes too much for that around dawn
+        weather_sum &data = result.hours[hour];
+        for( time_point t = hour_start; t < hour_start + 1_hours; t += 10_minutes ) {
+            proc_weather_sum( wtype, data, t, 10_minutes );
+        }
+        result.total.rain_amount += data.rain_amount;
+        result.total.acid_amount += data.acid_amount;
+        result.total.sunlight += data.sunlight;
+    }
+    return result;
+}
+
+/** Adds the rain and sunlight of the given time span, looked up in whole hours and days */
+static void sum_past_conditions( weather_sum &data, const time_point &start, const time_point &end,
+                                 const tripoint_abs_omt &omt )
+{
+    time_point t = start;
+    while( t < end ) {
+        const int day = to_days<int>( t - calendar::turn_zero );
+        const time_point day_start = calendar::turn_zero + 1_days * day;
+        const weather_day &weather = get_weather_day( omt, day );
+        if( t == day_start && end - t >= 1_days ) {
+            data.rain_amount += weather.total.rain_amount;
+            data.acid_amount += weather.total.acid_amount;
+            data.sunlight += weather.total.sunlight;
+            t += 1_days;
+            continue;
+        }
+        const int hour = to_hours<int>( t - day_start );
+        const time_point hour_end = std::min( end, day_start + 1_hours * ( hour + 1 ) );
+        const double fraction = ( hour_end - t ) / 1_hours;
+        const weather_sum &sample = weather.hours[hour];
+        data.rain_amount += std::lround( sample.rain_amount * fraction );
+        data.acid_amount += std::lround( sample.acid_amount * fraction );
+        data.sunlight += sample.sunlight * fraction;
+        t = hour_end;
     }
-    return wgen.get_weather_conditions( location, t, g->get_seed() );
 }
 
 ////// Funnels.
 weather_sum sum_conditions( const time_point &start, const time_point &end,
                             const tripoint &location )
 {
-    time_duration tick_size = 0_turns;
     weather_sum data;
+    if( start >= end ) {
+        return data;
+    }
+    const weather_manager &weather = get_weather();
+    const tripoint_abs_omt omt( ms_to_omt_copy( location ) );
+
+    // Only the last week is sampled every minute, older weather comes from the shared timeline
+    time_point recent = start;
+    if( end - start > 7_days && weather.weather_override == WEATHER_NULL ) {
+        recent = end - 7_days;
+        sum_past_conditions( data, start, recent, omt );
+    }
 
-    for( time_point t = start; t < end; t += tick_size ) {
+    time_duration tick_size = 0_turns;
+    for( time_point t = recent; t < end; t += tick_size ) {
         const time_duration diff = end - t;
         if( diff < 10_turns ) {
             tick_size = 1_turns;
@@ -191,12 +286,12 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
 
         weather_type_id wtype = current_weather( location, t );
         proc_weather_sum( wtype, data, t, tick_size );
-        data.wind_amount += get_local_windpower( g->weather.windspeed,
-                            // TODO: fix point types
-                            overmap_buffer.ter( tripoint_abs_omt( ms_to_omt_copy( location ) ) ),
-                            location,
-                            g->weather.winddirection, false ) * to_turns<int>( tick_size );
     }
+
+    // The wind is taken from the current weather, so it's the same for the whole time span
+    // TODO: fix point types
+    data.wind_amount = get_local_windpower( weather.windspeed, overmap_buffer.ter( omt ), location,
+                                            weather.winddirection, false ) * to_turns<int>( end - start );
     return data;
 }
 
@@ -0,0 +1,68 @@
+#if defined(TILES)
+
+#include "cata_tiles.h"
+
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "point.h"
+#include "sdl_geometry.h"
+#include "sdl_wrappers.h"
+#include "type_id.h"
+
+TEST_CASE( "terrain_frame_is_only_reused_while_nothing_changed", "[cata_tiles]" )
+{
+    clear_map();
+    const SDL_Surface_Ptr target = CreateRGBSurface( 0, 640, 480, 32, 0xff0000, 0xff00, 0xff,
+                                   0xff000000 );
+    REQUIRE( target );
+    const SDL_Renderer_Ptr renderer( SDL_CreateSoftwareRenderer( target.get() ) );
+    REQUIRE( renderer );
+    const GeometryRenderer_Ptr geometry( new DefaultGeometryRenderer() );
+    cata_tiles tiles( renderer, geometry );
+
+    map &here = get_map();
+    avatar &you = get_avatar();
+    const tripoint center = you.pos();
+    const tripoint near = center + tripoint( 2, 2, 0 );
+    const cata_tiles::frame_state before = tiles.get_frame_state( point_zero, center, 640, 480 );
+    const auto reusable = [&]() {
+        return tiles.get_frame_state( point_zero, center, 640, 480 ) == before;
+    };
+
+    SECTION( "nothing changed" ) {
+        CHECK( reusable() );
+    }
+    SECTION( "terrain changed without the avatar spending moves" ) {
+        here.ter_set( near, ter_id( "t_wall" ) );
+        CHECK_FALSE( reusable() );
+    }
+    SECTION( "item placed" ) {
+        here.add_item( near, item( "rock" ) );
+        CHECK_FALSE( reusable() );
+    }
+    SECTION( "monster spawned" ) {
+        spawn_test_monster( "mon_zombie", near );
+        CHECK_FALSE( reusable() );
+    }
+    SECTION( "avatar spent moves" ) {
+        you.mod_moves( -1 );
+        CHECK_FALSE( reusable() );
+        you.mod_moves( 1 );
+    }
+    SECTION( "turn passed" ) {
+        const time_point start = calendar::turn;
+        calendar::turn += 1_turns;
+        CHECK_FALSE( reusable() );
+        calendar::turn = start;
+    }
+    SECTION( "view moved" ) {
+        CHECK( tiles.get_frame_state( point_zero, center + tripoint_east, 640, 480 ) != before );
+    }
+    clear_map();
+}
+
+#endif
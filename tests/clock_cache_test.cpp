@@ -0,0 +1,133 @@
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include "cata_catch.h"
+#include "clock_cache.h"
+#include "lru_cache.h"
+#include "point.h"
+#include "rng.h"
+
+TEST_CASE( "clock_cache_stores_and_removes_values", "[clock_cache]" )
+{
+    clock_cache<point, char> cache( 16 );
+    CHECK( cache.get( point_zero, -1 ) == -1 );
+
+    cache.insert( point_zero, 1 );
+    cache.insert( point_east, 2 );
+    CHECK( cache.size() == 2 );
+    CHECK( cache.get( point_zero, -1 ) == 1 );
+    CHECK( cache.get( point_east, -1 ) == 2 );
+
+    cache.insert( point_zero, 3 );
+    CHECK( cache.size() == 2 );
+    CHECK( cache.get( point_zero, -1 ) == 3 );
+
+    cache.remove( point_zero );
+    CHECK( cache.size() == 1 );
+    CHECK( cache.get( point_zero, -1 ) == -1 );
+    CHECK( cache.get( point_east, -1 ) == 2 );
+
+    cache.clear();
+    CHECK( cache.size() == 0 );
+    CHECK( cache.get( point_east, -1 ) == -1 );
+
+    CHECK( cache.stats().hits == 4 );
+    CHECK( cache.stats().misses == 3 );
+}
+
+TEST_CASE( "clock_cache_keeps_recently_used_entries", "[clock_cache]" )
+{
+    clock_cache<int, int> cache( 4 );
+    for( int i = 0; i < 4; ++i ) {
+        cache.insert( i, i );
+    }
+    // all entries unused, the hand evicts the first one it finds
+    cache.get( 0, -1 );
+    cache.insert( 4, 4 );
+    CHECK( cache.size() == 4 );
+    CHECK( cache.stats().evictions == 1 );
+    CHECK( cache.get( 0, -1 ) == 0 );
+    CHECK( cache.get( 4, -1 ) == 4 );
+}
+
+TEST_CASE( "clock_cache_matches_a_reference_map", "[clock_cache]" )
+{
+    // Many colliding keys in a small table, so removals have to shift entries around.
+    constexpr size_t limit = 50;
+    clock_cache<point, int> cache( limit );
+    std::map<point, int> reference;
+    for( int i = 0; i < 20000; ++i ) {
+        const point p( rng( -10, 10 ), rng( -10, 10 ) );
+        const int action = rng( 0, 3 );
+        if( action == 0 ) {
+            cache.remove( p );
+            reference.erase( p );
+        } else if( action == 1 || cache.size() < limit ) {
+            cache.insert( p, i );
+            reference[p] = i;
+        } else {
+            const int cached = cache.get( p, -1 );
+            // evicted entries are allowed to be missing, but never wrong
+            if( cached != -1 ) {
+                REQUIRE( reference.count( p ) == 1 );
+                CHECK( reference[p] == cached );
+            }
+        }
+        REQUIRE( cache.size() <= limit );
+    }
+}
+
+static std::vector<point> benchmark_keys( const bool skewed )
+{
+    std::vector<point> keys;
+    for( int i = 0; i < 1 << 20; i++ ) {
+        if( !skewed ) {
+            // 50000 keys, half of the capacity
+            keys.emplace_back( i % 250, ( i / 250 ) % 200 );
+        } else if( one_in( 10 ) ) {
+            // 400000 keys, four times the capacity
+            keys.emplace_back( rng( 0, 1999 ), rng( 0, 199 ) );
+        } else {
+            // 20000 keys that are looked up most of the time
+            keys.emplace_back( rng( 0, 99 ), rng( 0, 199 ) );
+        }
+    }
+    return keys;
+}
+
+static void run_cache_benchmark( const std::vector<point> &keys )
+{
+    constexpr int limit = 100000;
+    lru_cache<point, char> lru;
+    clock_cache<point, char> clock( limit );
+    size_t i = 0;
+    BENCHMARK( "lru_cache" ) {
+        const point &p = keys[i++ % keys.size()];
+        const char cached = lru.get( p, -1 );
+        if( cached < 0 ) {
+            lru.insert( limit, p, 1 );
+        }
+        return cached;
+    };
+    i = 0;
+    BENCHMARK( "clock_cache" ) {
+        const point &p = keys[i++ % keys.size()];
+        const char cached = clock.get( p, -1 );
+        if( cached < 0 ) {
+            clock.insert( p, 1 );
+        }
+        return cached;
+    };
+    WARN( "clock_cache hit rate: " << clock.stats().hit_rate() );
+}
+
+TEST_CASE( "clock_cache_benchmark", "[.][clock_cache][benchmark]" )
+{
+    SECTION( "working set fits" ) {
+        run_cache_benchmark( benchmark_keys( false ) );
+    }
+    SECTION( "skewed working set larger than the cache" ) {
+        run_cache_benchmark( benchmark_keys( true ) );
+    }
+}
@@ -1,13 +1,21 @@
 #include <iosfwd>
+#include <list>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "activity_handlers.h"
 #include "cata_catch.h"
+#include "character.h"
 #include "clzones.h"
+#include "game_constants.h"
 #include "item.h"
 #include "item_category.h"
 #include "item_contents.h"
 #include "item_pocket.h"
+#include "map.h"
 #include "map_helpers.h"
+#include "player_helpers.h"
 #include "point.h"
 #include "ret_val.h"
 #include "type_id.h"
@@ -235,3 +243,153 @@ TEST_CASE( "zone sorting comestibles ", "[zones][items][food][activities]" )
         }
     }
 }
+
+TEST_CASE( "zone_queries_follow_zone_changes", "[zones]" )
+{
+    clear_map();
+    zone_manager &zm = zone_manager::get_manager();
+    // far away from the zones of other tests
+    const tripoint where( 5000, 5000, 0 );
+    REQUIRE_FALSE( zm.has_near( zone_type_LOOT_PFOOD, where, 5 ) );
+
+    create_tile_zone( "Perishable near", zone_type_LOOT_PFOOD, where + tripoint_east );
+    CHECK( zm.has_near( zone_type_LOOT_PFOOD, where, 5 ) );
+    CHECK( zm.get_near( zone_type_LOOT_PFOOD, where, 5 ) ==
+           std::unordered_set<tripoint> { where + tripoint_east } );
+
+    create_tile_zone( "Perishable far", zone_type_LOOT_PFOOD, where + tripoint( 8, 0, 0 ) );
+    CHECK( zm.get_near( zone_type_LOOT_PFOOD, where, 5 ).size() == 1 );
+    CHECK( zm.get_near( zone_type_LOOT_PFOOD, where, 10 ).size() == 2 );
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_PFOOD, where + tripoint_above, 10 ) );
+
+    for( const char *name : {
+             "Perishable near", "Perishable far"
+         } ) {
+        for( zone_manager::ref_zone_data zone : zm.get_zones() ) {
+            if( zone.get().get_name() == name ) {
+                zm.remove( zone.get() );
+                break;
+            }
+        }
+    }
+    zm.cache_data();
+    CHECK_FALSE( zm.has_near( zone_type_LOOT_PFOOD, where, 10 ) );
+    CHECK( zm.get_near( zone_type_LOOT_PFOOD, where, 10 ).empty() );
+}
+
+static item backpack_with_rocks()
+{
+    item backpack( "test_backpack" );
+    for( int i = 0; i < 4; i++ ) {
+        backpack.put_in( item( "test_rock" ), item_pocket::pocket_type::CONTAINER );
+    }
+    return backpack;
+}
+
+// Sorts all items on the source tiles into their zones the way the loot sorting activity does,
+// either moving each item or copying it and removing the original.
+static void sort_into_zones( const std::vector<tripoint> &sources, const bool by_move )
+{
+    map &here = get_map();
+    Character &you = get_player_character();
+    const zone_manager &zm = zone_manager::get_manager();
+    for( const tripoint &src : sources ) {
+        map_stack stack = here.i_at( src );
+        while( !stack.empty() ) {
+            item &it = *stack.begin();
+            const tripoint abs_src = here.getabs( src );
+            const zone_type_id type = zm.get_near_zone_type_for_item( it, abs_src );
+            tripoint dest = src;
+            for( const tripoint &abs_dest : zm.get_near( type, abs_src ) ) {
+                const tripoint candidate = here.getlocal( abs_dest );
+                if( static_cast<int>( here.i_at( candidate ).size() ) < MAX_ITEM_IN_SQUARE ) {
+                    dest = candidate;
+                    break;
+                }
+            }
+            REQUIRE( dest != src );
+            if( by_move ) {
+                std::list<item> moved;
+                moved.push_back( here.i_take( src, &it ) );
+                put_into_vehicle_or_drop( you, item_drop_reason::deliberate, std::move( moved ), dest );
+            } else {
+                put_into_vehicle_or_drop( you, item_drop_reason::deliberate, { it }, dest );
+                here.i_rem( src, &it );
+            }
+        }
+    }
+}
+
+static void create_sort_zones( const zone_type_id &type, const tripoint &unsorted )
+{
+    map &here = get_map();
+    zone_manager &zm = zone_manager::get_manager();
+    zm.add( "Unsorted", zone_type_id( "LOOT_UNSORTED" ), faction_id( "your_followers" ), false, true,
+            here.getabs( unsorted ), here.getabs( unsorted ) );
+    zm.add( "Sorted", type, faction_id( "your_followers" ), false, true,
+            here.getabs( unsorted + point( 2, -1 ) ), here.getabs( unsorted + point( 4, 1 ) ) );
+}
+
+TEST_CASE( "sorting_moves_items_with_their_contents", "[zones][items][activities]" )
+{
+    clear_map();
+    clear_avatar();
+    map &here = get_map();
+    const tripoint src = get_player_character().pos();
+    const item sample = backpack_with_rocks();
+    REQUIRE_FALSE( sample.contents.empty() );
+    const zone_type_id type = zone_manager::get_manager().get_near_zone_type_for_item( sample,
+                              here.getabs( src ) );
+    REQUIRE( type.is_valid() );
+    create_sort_zones( type, src );
+
+    for( int i = 0; i < 20; i++ ) {
+        here.add_item( src, sample );
+    }
+    sort_into_zones( { src }, true );
+
+    CHECK( here.i_at( src ).empty() );
+    int sorted = 0;
+    for( const tripoint &p : here.points_in_rectangle( src + point( 2, -1 ), src + point( 4, 1 ) ) ) {
+        for( const item &it : here.i_at( p ) ) {
+            CHECK( it.typeId() == sample.typeId() );
+            CHECK( it.weight() == sample.weight() );
+            sorted++;
+        }
+    }
+    CHECK( sorted == 20 );
+}
+
+TEST_CASE( "sorting_benchmark", "[.][zones][items][benchmark]" )
+{
+    clear_map();
+    clear_avatar();
+    map &here = get_map();
+    const tripoint origin = get_player_character().pos();
+    const std::vector<tripoint> sources = { origin, origin + tripoint_north, origin + tripoint_south };
+    const item sample = backpack_with_rocks();
+    create_sort_zones( zone_manager::get_manager().get_near_zone_type_for_item( sample,
+                       here.getabs( origin ) ), origin );
+
+    const auto spawn_items = [&]() {
+        for( const tripoint &p : here.points_in_rectangle( origin + point( 2, -1 ),
+                origin + point( 4, 1 ) ) ) {
+            here.i_clear( p );
+        }
+        for( int i = 0; i < 10000; i++ ) {
+            here.add_item( sources[i % sources.size()], sample );
+        }
+    };
+
+    // Spawning the items is part of both, so only the difference between them is meaningful.
+    BENCHMARK( "sort 10000 items by copy" ) {
+        spawn_items();
+        sort_into_zones( sources, false );
+        return here.i_at( origin ).size();
+    };
+    BENCHMARK( "sort 10000 items by move" ) {
+        spawn_items();
+        sort_into_zones( sources, true );
+        return here.i_at( origin ).size();
+    };
+}
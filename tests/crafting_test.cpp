@@ -16,6 +16,7 @@
 #include "cata_utility.h"
 #include "cata_catch.h"
 #include "character.h"
+#include "crafting_gui.h"
 #include "game.h"
 #include "inventory.h"
 #include "item.h"
@@ -36,6 +37,7 @@
 #include "skill.h"
 #include "temp_crafting_inventory.h"
 #include "type_id.h"
+#include "uistate.h"
 #include "value_ptr.h"
 
 TEST_CASE( "recipe_subset" )
@@ -122,6 +124,79 @@ TEST_CASE( "recipe_subset" )
     }
 }
 
+TEST_CASE( "recipe_subset_name_search_ignores_case", "[recipes]" )
+{
+    recipe_subset subset;
+    for( const auto &e : recipe_dict ) {
+        if( !e.second.obsolete ) {
+            subset.include( &e.second );
+        }
+    }
+    const recipe_id favorite( "brew_rum" );
+    const std::set<recipe_id> old_favorites = uistate.favorite_recipes;
+    uistate.favorite_recipes = { favorite };
+
+    // the lower-case name cache must find what matching the result name finds
+    const std::vector<std::string> queries = {
+        "RUM", "bReW", "* ", "* rUm", "sTeEl", "zzz_no_such_recipe"
+    };
+    for( const std::string &query : queries ) {
+        CAPTURE( query );
+        std::set<const recipe *> expected;
+        std::set<const recipe *> expected_excluded;
+        for( const recipe *r : subset ) {
+            if( lcmatch( r->result_name(), query ) ) {
+                expected.insert( r );
+            } else {
+                expected_excluded.insert( r );
+            }
+        }
+        const std::vector<const recipe *> found = subset.search( query,
+                recipe_subset::search_type::name );
+        CHECK( std::set<const recipe *>( found.begin(), found.end() ) == expected );
+        const std::vector<const recipe *> excluded = subset.search( query,
+                recipe_subset::search_type::exclude_name );
+        CHECK( std::set<const recipe *>( excluded.begin(), excluded.end() ) == expected_excluded );
+    }
+    CHECK( subset.search( "* RUM", recipe_subset::search_type::name ).size() == 1 );
+
+    uistate.favorite_recipes = old_favorites;
+}
+
+TEST_CASE( "crafting_menu_availability_follows_inventory_and_skills", "[crafting][recipes]" )
+{
+    clear_avatar();
+    Character &player_character = get_player_character();
+    const recipe &r = recipe_id( "test_base_stove_1" ).obj();
+
+    item saw( "hacksaw" );
+    item pipe( "pipe" );
+    item tank( "metal_tank" );
+    temp_crafting_inventory inv;
+    inv.add_item_ref( saw );
+    inv.add_item_ref( pipe );
+    CHECK_FALSE( cached_recipe_availability( r, inv ).can_craft );
+
+    // a new component makes the recipe craftable
+    inv.add_item_ref( tank );
+    CHECK( cached_recipe_availability( r, inv ).can_craft );
+    CHECK_FALSE( cached_recipe_availability( r, inv ).has_all_skills );
+
+    // learning the skills it asks for is noticed
+    player_character.set_skill_level( skill_id( "fabrication" ), 5 );
+    player_character.set_skill_level( skill_id( "mechanics" ), 3 );
+    CHECK( cached_recipe_availability( r, inv ).has_all_skills );
+    player_character.set_skill_level( skill_id( "mechanics" ), 2 );
+    CHECK_FALSE( cached_recipe_availability( r, inv ).has_all_skills );
+
+    // and so is losing a component or tool
+    temp_crafting_inventory without_saw;
+    without_saw.add_item_ref( pipe );
+    without_saw.add_item_ref( tank );
+    CHECK_FALSE( cached_recipe_availability( r, without_saw ).can_craft );
+    CHECK( cached_recipe_availability( r, inv ).can_craft );
+}
+
 TEST_CASE( "available_recipes", "[recipes]" )
 {
     const recipe *r = &recipe_id( "magazine_battery_light_mod" ).obj();
@@ -345,6 +420,11 @@ static void prep_craft( const recipe_id &rid, const std::vector<item> &tools,
     bool can_craft_with_temp_inv = r.deduped_requirements().can_make_with_inventory(
                                        temp_crafting_inventory( crafting_inv ), r.get_component_filter() );
     REQUIRE( can_craft_with_temp_inv == expect_craftable );
+    temp_crafting_inventory crafting_view;
+    player_character.form_crafting_inventory( crafting_view );
+    bool can_craft_with_crafting_view = r.deduped_requirements().can_make_with_inventory(
+                                            crafting_view, r.get_component_filter() );
+    REQUIRE( can_craft_with_crafting_view == expect_craftable );
 }
 
 static time_point midnight = calendar::turn_zero + 0_hours;
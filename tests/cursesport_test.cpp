@@ -0,0 +1,74 @@
+#include "cursesport.h"
+
+#if defined(TILES) || defined(_WIN32)
+
+#include <string>
+
+#include "cata_catch.h"
+
+using cata_cursesport::cell_text;
+
+static cell_text make_text( const std::string &s )
+{
+    return cell_text( s.data(), s.size() );
+}
+
+TEST_CASE( "cell_text_keeps_short_text", "[cursesport]" )
+{
+    CHECK( cell_text().empty() );
+    CHECK( make_text( " " ).is_space() );
+    CHECK_FALSE( make_text( "  " ).is_space() );
+    CHECK( make_text( "a" ).str() == "a" );
+
+    // a wide character takes two columns but is still one cell
+    const cell_text wide = make_text( "你" );
+    CHECK( wide.size() == 3 );
+    CHECK( wide.str() == "你" );
+    CHECK( wide.codepoint() == 0x4F60 );
+
+    // zero width characters stay in the cell of the character they follow
+    const std::string accented = "e\xCC\x81";
+    const cell_text combined = make_text( accented );
+    CHECK( combined.str() == accented );
+    CHECK( combined.codepoint() == 'e' );
+
+    const std::string full = "ab你你你";
+    REQUIRE( full.size() == cell_text::capacity );
+    CHECK( make_text( full ).str() == full );
+}
+
+TEST_CASE( "cell_text_cuts_long_text_at_a_character_boundary", "[cursesport]" )
+{
+    // the third wide character would end one byte after the capacity
+    CHECK( make_text( "abc你你你" ).str() == "abc你你" );
+    // four byte characters
+    CHECK( make_text( "\U0001F600\U0001F600\U0001F600" ).str() == "\U0001F600\U0001F600" );
+    // the cut falls right after a character
+    CHECK( make_text( "ab你你你d" ).str() == "ab你你你" );
+    // a character with more combining marks than fit
+    const std::string mark = "\xCC\x81";
+    const std::string marks = "e" + mark + mark + mark + mark + mark + mark;
+    CHECK( make_text( marks ).str() == marks.substr( 0, 1 + 5 * mark.size() ) );
+    CHECK( make_text( marks ).codepoint() == 'e' );
+}
+
+TEST_CASE( "cell_text_compares_only_the_stored_text", "[cursesport]" )
+{
+    CHECK( make_text( "a" ) == make_text( "a" ) );
+    CHECK( make_text( "a" ) != make_text( "b" ) );
+    CHECK( make_text( "a" ) != make_text( "ab" ) );
+    CHECK( make_text( "你" ) != make_text( "佡" ) );
+    CHECK( cell_text() == make_text( "" ) );
+
+    // bytes left over from longer text don't count
+    cell_text reused = make_text( "你你" );
+    reused.assign( "x", 1 );
+    CHECK( reused == make_text( "x" ) );
+    reused.clear();
+    CHECK( reused == cell_text() );
+
+    // text cut to the same characters compares equal
+    CHECK( make_text( "abc你你你" ) == make_text( "abc你你" ) );
+}
+
+#endif
@@ -471,6 +471,17 @@ TEST_CASE( "effect modifiers", "[effect][modifier]" )
     }
 }
 
+TEST_CASE( "effect_modifier_benchmark", "[.][effect][modifier][benchmark]" )
+{
+    const efftype_id eff_id( "intensified" );
+    effect eff_intense( effect_source::empty(), &eff_id.obj(), 1_turns, bodypart_str_id( "bp_null" ),
+                        false, 2, calendar::turn );
+    BENCHMARK( "get_mod" ) {
+        return eff_intense.get_mod( "INT" ) + eff_intense.get_mod( "PER" ) +
+               eff_intense.get_mod( "STR" ) + eff_intense.get_mod( "DEX" );
+    };
+}
+
 TEST_CASE( "bleed_effect_attribution", "[effect][bleed][monster]" )
 {
     const auto spawn_npc = [&]( const point & p, const std::string & npc_class ) {
@@ -91,3 +91,53 @@ TEST_CASE( "notify_subscriber_2", "[event]" )
     sub.notify( original_event );
     REQUIRE( sub.found );
 }
+
+TEST_CASE( "read_event_fields_by_index_and_name", "[event]" )
+{
+    const cata::event made = cata::event::make<event_type::character_kills_character>(
+                                 character_id( 5 ), character_id( 6 ), std::string( "Bob" ) );
+    constexpr size_t victim = cata::event::field<event_type::character_kills_character>( "victim" );
+    constexpr size_t victim_name =
+        cata::event::field<event_type::character_kills_character>( "victim_name" );
+    static_assert( victim == 1, "fields are numbered in the order of the event_spec" );
+    static_assert( cata::event::field<event_type::character_kills_character>( "victim_" ) == 3,
+                   "unknown names give the number of fields" );
+    CHECK( made.get<event_type::character_kills_character, 0>() == character_id( 5 ) );
+    CHECK( made.get<event_type::character_kills_character, victim>() == character_id( 6 ) );
+    CHECK( made.get<event_type::character_kills_character, victim_name>() == "Bob" );
+    CHECK( made.get_variant_or_void( "no_such_field" ).type() == cata_variant_type::void_ );
+
+    const cata::event::data_type expected = {
+        { "killer", cata_variant( character_id( 5 ) ) },
+        { "victim", cata_variant( character_id( 6 ) ) },
+        { "victim_name", cata_variant::make<cata_variant_type::string>( "Bob" ) },
+    };
+    CHECK( made.data() == expected );
+
+    // events built from a data map, as done for event transformations
+    cata::event::data_type data = expected;
+    const cata::event from_data( made.type(), made.time(), std::move( data ) );
+    CHECK( from_data.get<event_type::character_kills_character, 0>() == character_id( 5 ) );
+    CHECK( from_data.get<character_id>( "victim" ) == character_id( 6 ) );
+    CHECK( from_data.data() == made.data() );
+}
+
+TEST_CASE( "send_event_benchmark", "[.][event][benchmark]" )
+{
+    event_bus bus;
+    expect_subscriber sub;
+    bus.subscribe( &sub );
+    int damage = 0;
+    BENCHMARK( "event_bus::send" ) {
+        bus.send<event_type::character_takes_damage>( character_id( 5 ), ++damage );
+        return sub.found;
+    };
+    const cata::event e = cata::event::make<event_type::character_takes_damage>(
+                              character_id( 5 ), 10 );
+    BENCHMARK( "event::get by name" ) {
+        return e.get<int>( "damage" );
+    };
+    BENCHMARK( "event::get by index" ) {
+        return e.get<event_type::character_takes_damage, 1>();
+    };
+}
@@ -0,0 +1,108 @@
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "game.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "npc.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "type_id.h"
+#include "weather.h"
+
+static const activity_id ACT_WAIT( "ACT_WAIT" );
+
+static const efftype_id effect_sleep( "sleep" );
+
+TEST_CASE( "fast_forward_only_while_nothing_can_interrupt", "[sleep]" )
+{
+    clear_avatar();
+    clear_map();
+    avatar &you = get_avatar();
+    CHECK_FALSE( g->can_fast_forward() );
+
+    SECTION( "waiting" ) {
+        you.assign_activity( ACT_WAIT, to_moves<int>( 8_hours ) );
+        CHECK( g->can_fast_forward() );
+        you.cancel_activity();
+        CHECK_FALSE( g->can_fast_forward() );
+    }
+    SECTION( "sleeping" ) {
+        you.add_effect( effect_sleep, 8_hours );
+        CHECK( g->can_fast_forward() );
+
+        SECTION( "until a hostile monster shows up" ) {
+            spawn_test_monster( "mon_zombie", you.pos() + tripoint( 30, 0, 0 ) );
+            CHECK_FALSE( g->can_fast_forward() );
+        }
+        SECTION( "until an NPC is awake" ) {
+            spawn_npc( you.pos().xy() + point( 5, 0 ), "thug" );
+            CHECK_FALSE( g->can_fast_forward() );
+        }
+        SECTION( "until there is a fire" ) {
+            get_map().add_field( you.pos(), field_type_id( "fd_fire" ), 1 );
+            CHECK_FALSE( g->can_fast_forward() );
+        }
+        you.remove_effect( effect_sleep );
+        CHECK_FALSE( g->can_fast_forward() );
+    }
+    clear_map();
+}
+
+TEST_CASE( "fast_forwarded_sleep_still_passes_every_turn", "[sleep]" )
+{
+    clear_avatar();
+    clear_map();
+    avatar &you = get_avatar();
+    weather_manager &weather = get_weather();
+    const int old_temperature = weather.temperature;
+    const time_point old_nextweather = weather.nextweather;
+    weather.temperature = 75;
+    weather.nextweather = calendar::turn + 2_hours;
+    weather.clear_temp_cache();
+    you.set_fatigue( 600 );
+    you.fall_asleep( 8_hours );
+    REQUIRE( g->can_fast_forward() );
+
+    const time_point start = calendar::turn;
+    const int kcal_before = you.get_stored_kcal();
+    while( calendar::turn < start + 1_hours ) {
+        g->do_turn();
+    }
+    CHECK( you.has_effect( effect_sleep ) );
+    // The body caught up on the hour, and sleep was processed all along
+    CHECK( you.get_stored_kcal() < kcal_before );
+    CHECK( you.get_fatigue() < 600 );
+    you.wake_up();
+    weather.temperature = old_temperature;
+    weather.nextweather = old_nextweather;
+    weather.clear_temp_cache();
+    clear_map();
+}
+
+TEST_CASE( "sleep_eight_hours_benchmark", "[.][sleep][benchmark]" )
+{
+    clear_avatar();
+    clear_map();
+    avatar &you = get_avatar();
+    weather_manager &weather = get_weather();
+    const int old_temperature = weather.temperature;
+    const time_point old_nextweather = weather.nextweather;
+    BENCHMARK( "eight hours" ) {
+        // Keep it warm, or the cold wakes the avatar up early
+        weather.temperature = 75;
+        weather.nextweather = calendar::turn + 9_hours;
+        weather.clear_temp_cache();
+        you.set_fatigue( 600 );
+        you.fall_asleep( 8_hours );
+        const time_point wake_up = calendar::turn + 8_hours;
+        while( calendar::turn < wake_up && you.has_effect( effect_sleep ) ) {
+            g->do_turn();
+        }
+        return calendar::turn;
+    };
+    weather.temperature = old_temperature;
+    weather.nextweather = old_nextweather;
+    weather.clear_temp_cache();
+    clear_map();
+}
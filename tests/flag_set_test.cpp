@@ -0,0 +1,121 @@
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cata_catch.h"
+#include "flag.h"
+#include "flag_set.h"
+#include "item.h"
+#include "itype.h"
+#include "type_id.h"
+
+static const itype_id itype_test_rock( "test_rock" );
+
+TEST_CASE( "flag_set_basic_operations", "[flag]" )
+{
+    flag_set flags;
+    CHECK( flags.empty() );
+    CHECK( flags.count( flag_WET ) == 0 );
+
+    CHECK( flags.insert( flag_WET ).second );
+    CHECK_FALSE( flags.insert( flag_WET ).second );
+    CHECK( flags.insert( flag_FROZEN ).second );
+    CHECK( flags.size() == 2 );
+    CHECK( flags.count( flag_WET ) == 1 );
+    CHECK( flags.count( flag_FROZEN ) == 1 );
+    CHECK( flags.count( flag_HOT ) == 0 );
+
+    CHECK( flags.erase( flag_HOT ) == 0 );
+    CHECK( flags.erase( flag_WET ) == 1 );
+    CHECK( flags.size() == 1 );
+    CHECK( flags.count( flag_WET ) == 0 );
+
+    flags.clear();
+    CHECK( flags.empty() );
+    CHECK( flags.begin() == flags.end() );
+}
+
+TEST_CASE( "flag_set_iteration_and_equality", "[flag]" )
+{
+    const std::set<flag_id> expected = { flag_COLD, flag_FIT, flag_WET, flag_HOT };
+    const flag_set flags( expected.begin(), expected.end() );
+
+    std::set<flag_id> seen;
+    for( const flag_id &f : flags ) {
+        CHECK( seen.insert( f ).second );
+    }
+    CHECK( seen == expected );
+
+    flag_set other = { flag_HOT, flag_WET, flag_FIT };
+    CHECK( flags != other );
+    other.insert( flag_COLD );
+    CHECK( flags == other );
+
+    // erasing a flag must not leave storage behind that breaks equality
+    other.insert( flag_ZOOM );
+    other.erase( flag_ZOOM );
+    CHECK( flags == other );
+}
+
+TEST_CASE( "flag_set_erase_while_iterating", "[flag]" )
+{
+    flag_set flags = { flag_COLD, flag_FIT, flag_WET, flag_HOT };
+    erase_if( flags, []( const flag_id & f ) {
+        return f == flag_COLD || f == flag_HOT;
+    } );
+    CHECK( flags == flag_set( { flag_FIT, flag_WET } ) );
+}
+
+TEST_CASE( "flag_set_unknown_flags", "[flag]" )
+{
+    const flag_id unknown( "flag_set_test_undefined_flag" );
+    REQUIRE_FALSE( unknown.is_valid() );
+
+    flag_set flags;
+    CHECK( flags.count( unknown ) == 0 );
+    flags.insert( unknown );
+    CHECK( flags.count( unknown ) == 1 );
+    CHECK( *flags.begin() == unknown );
+    flags.erase( unknown );
+    CHECK( flags.empty() );
+}
+
+TEST_CASE( "item_flags_from_type_and_instance", "[item][flag]" )
+{
+    item rock( itype_test_rock );
+    REQUIRE_FALSE( rock.has_flag( flag_WET ) );
+
+    rock.set_flag( flag_WET );
+    CHECK( rock.has_flag( flag_WET ) );
+    CHECK( rock.has_own_flag( flag_WET ) );
+    CHECK_FALSE( rock.type->has_flag( flag_WET ) );
+
+    rock.unset_flag( flag_WET );
+    CHECK_FALSE( rock.has_flag( flag_WET ) );
+}
+
+TEST_CASE( "flag_set_benchmark", "[.][flag][benchmark]" )
+{
+    const std::vector<flag_id> lookups = { flag_WET, flag_FROZEN, flag_FIT, flag_HOT, flag_COLD,
+                                           flag_FILTHY, flag_NO_DROP, flag_ZOOM
+                                         };
+    const std::set<flag_id> tree_set = { flag_WET, flag_FIT, flag_FILTHY };
+    const flag_set bit_set( tree_set.begin(), tree_set.end() );
+
+    DYNAMIC_SECTION( "sizeof: std::set<flag_id>: " << sizeof( tree_set ) ) {}
+    DYNAMIC_SECTION( "sizeof: flag_set: " << sizeof( bit_set ) ) {}
+
+    size_t i = 0;
+    BENCHMARK( "std::set<flag_id>::count" ) {
+        return tree_set.count( lookups[i++ % lookups.size()] );
+    };
+    BENCHMARK( "flag_set::count" ) {
+        return bit_set.count( lookups[i++ % lookups.size()] );
+    };
+
+    item rock( itype_test_rock );
+    rock.set_flag( flag_WET );
+    BENCHMARK( "item::has_flag" ) {
+        return rock.has_flag( lookups[i++ % lookups.size()] );
+    };
+}
@@ -5,13 +5,18 @@
 #include <initializer_list>
 #include <limits>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "calendar.h"
+#include "cata_utility.h"
 #include "enums.h"
 #include "item_factory.h"
 #include "item_pocket.h"
+#include "item_var_map.h"
 #include "itype.h"
+#include "json.h"
 #include "math_defines.h"
 #include "monstergenerator.h"
 #include "mtype.h"
@@ -58,6 +63,75 @@ TEST_CASE( "gun_layer", "[item]" )
     CHECK( gun.get_layer() == layer_level::BELTED );
 }
 
+TEST_CASE( "weight_and_volume_follow_nested_changes", "[item]" )
+{
+    item backpack( "backpack" );
+    item bottle( "bottle_plastic" );
+    REQUIRE( bottle.put_in( item( "water_clean", calendar::turn_zero, 2 ),
+                            item_pocket::pocket_type::CONTAINER ).success() );
+    REQUIRE( backpack.put_in( bottle, item_pocket::pocket_type::CONTAINER ).success() );
+    const units::mass full_weight = backpack.weight();
+    const units::volume full_volume = backpack.volume();
+    const units::volume empty_volume = backpack.volume( false, true );
+    const units::mass water_weight = item( "water_clean", calendar::turn_zero, 1 ).weight();
+
+    item *found = nullptr;
+    backpack.visit_items( [&found]( item * it, item * ) {
+        if( it->typeId() == itype_id( "water_clean" ) ) {
+            found = it;
+            return VisitResponse::ABORT;
+        }
+        return VisitResponse::NEXT;
+    } );
+    REQUIRE( found != nullptr );
+    item &water = *found;
+
+    // the containers are not told about changes to nested items
+    water.charges = 1;
+    CHECK( backpack.weight() == full_weight - water_weight );
+
+    // not even when the nested item is replaced by another one of the same type and charges
+    item heavy_water( "water_clean", calendar::turn_zero, 1 );
+    heavy_water.set_var( "weight", std::to_string( units::to_milligram( water_weight ) * 2 ) );
+    water = heavy_water;
+    CHECK( backpack.weight() == full_weight );
+
+    // updating the temperature without changing the temperature flags is no change
+    water.set_item_temperature( temp_to_kelvin( 150 ) );
+    const size_t hot_state = water.state_hash();
+    water.set_item_temperature( temp_to_kelvin( 160 ) );
+    CHECK( water.state_hash() == hot_state );
+    water.set_item_temperature( temp_to_kelvin( 60 ) );
+    CHECK( water.state_hash() != hot_state );
+
+    backpack.set_var( "volume", 100 );
+    CHECK( backpack.volume() == 100 * units::legacy_volume_factor + full_volume - empty_volume );
+    backpack.erase_var( "volume" );
+    CHECK( backpack.volume() == full_volume );
+
+    backpack.set_flag( flag_id( "REDUCED_WEIGHT" ) );
+    CHECK( backpack.weight() < full_weight );
+}
+
+TEST_CASE( "item_weight_benchmark", "[.][item][benchmark]" )
+{
+    item backpack( "backpack" );
+    for( int i = 0; i < 10; ++i ) {
+        item bottle( "bottle_plastic" );
+        bottle.put_in( item( "water_clean", calendar::turn_zero, 2 ),
+                       item_pocket::pocket_type::CONTAINER );
+        backpack.put_in( bottle, item_pocket::pocket_type::CONTAINER );
+    }
+    BENCHMARK( "weight and volume" ) {
+        return units::to_gram( backpack.weight() ) + units::to_milliliter( backpack.volume() );
+    };
+    item &water = *backpack.all_items_top().front()->all_items_top().front();
+    BENCHMARK( "weight and volume after a nested item changed" ) {
+        water.charges = water.charges == 1 ? 2 : 1;
+        return units::to_gram( backpack.weight() ) + units::to_milliliter( backpack.volume() );
+    };
+}
+
 TEST_CASE( "stacking_cash_cards", "[item]" )
 {
     // Differently-charged cash cards should stack if neither is zero.
@@ -297,3 +371,51 @@ TEST_CASE( "item variables round-trip accurately", "[item]" )
     i.set_var( "C", tripoint( 2, 3, 4 ) );
     CHECK( i.get_var( "C", tripoint() ) == tripoint( 2, 3, 4 ) );
 }
+
+TEST_CASE( "item variables keep their saved string form", "[item]" )
+{
+    item i( "water" );
+    i.set_var( "int", -42 );
+    i.set_var( "double", 0.1 );
+    i.set_var( "text", "some text" );
+    i.set_var( "numeric_text", "17" );
+    i.set_var( "padded_number", "007" );
+
+    CHECK( i.get_var( "int" ) == "-42" );
+    CHECK( i.get_var( "double" ) == "0.100000" );
+    CHECK( i.get_var( "text" ) == "some text" );
+    CHECK( i.get_var( "numeric_text", 0 ) == 17 );
+    CHECK( i.get_var( "numeric_text" ) == "17" );
+    CHECK( i.get_var( "padded_number" ) == "007" );
+    CHECK( i.get_var( "padded_number", 0 ) == 7 );
+}
+
+TEST_CASE( "item_var_map_json_round_trip", "[item]" )
+{
+    item_var_map vars;
+    vars.set( "int", -42LL );
+    vars.set( "double", 1.0 / 3.0 );
+    vars.set( "text", "some text" );
+    vars.set( "padded_number", "007" );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.write( vars );
+    CHECK( os.str() == R"({"double":"0.333333","int":"-42","padded_number":"007",)"
+           R"("text":"some text"})" );
+
+    std::istringstream is( os.str() );
+    JsonIn jsin( is );
+    item_var_map loaded;
+    loaded.deserialize( jsin );
+    CHECK( loaded == vars );
+    // doubles keep the precision of their saved form
+    CHECK( loaded.find( "double" )->number() == vars.find( "double" )->number() );
+
+    item_var_map other = vars;
+    other.set( "dirt", 5LL );
+    other.erase( "text" );
+    CHECK( other != vars );
+    CHECK( other.equal_ignoring( vars, { "dirt", "text" } ) );
+    CHECK_FALSE( other.equal_ignoring( vars, { "dirt" } ) );
+}
@@ -1,6 +1,7 @@
 #include "cata_catch.h"
 #include "map.h"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -9,9 +10,11 @@
 #include "enums.h"
 #include "game.h"
 #include "game_constants.h"
+#include "item.h"
 #include "map_helpers.h"
 #include "point.h"
 #include "type_id.h"
+#include "units.h"
 
 TEST_CASE( "destroy_grabbed_furniture" )
 {
@@ -90,6 +93,54 @@ TEST_CASE( "place_player_can_safely_move_multiple_submaps" )
     // Regression test for the situation where game::place_player would misuse
     // map::shift if the resulting shift exceeded a single submap, leading to a
     // broken active item cache.
+    map &here = get_map();
+    const tripoint_abs_sm start_abs_sub( here.get_abs_sub() );
+    const tripoint start_pos = get_avatar().pos();
     g->place_player( tripoint_zero );
-    CHECK( get_map().check_submap_active_item_consistency().empty() );
+    CHECK( here.check_submap_active_item_consistency().empty() );
+    // Later tests assume the map has not moved, so put it back.
+    here.load( start_abs_sub, false );
+    get_avatar().setpos( start_pos );
+}
+
+TEST_CASE( "map_content_generation_follows_changes" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint p( 60, 60, 0 );
+    uint64_t generation = here.get_content_generation();
+    const auto changed = [&]() {
+        const uint64_t now = here.get_content_generation();
+        const bool ret = now != generation;
+        generation = now;
+        return ret;
+    };
+
+    // Looking at the map is not a change
+    here.ter( p );
+    here.i_at( p );
+    CHECK_FALSE( changed() );
+    // Nor is setting what is already there
+    here.ter_set( p, here.ter( p ) );
+    CHECK_FALSE( changed() );
+
+    here.ter_set( p, ter_id( "t_wall" ) );
+    CHECK( changed() );
+    here.furn_set( p + tripoint_east, furn_id( "f_chair" ) );
+    CHECK( changed() );
+    here.trap_set( p + tripoint_west, trap_id( "tr_bubblewrap" ) );
+    CHECK( changed() );
+    here.remove_trap( p + tripoint_west );
+    CHECK( changed() );
+    here.add_field( p + tripoint_south, field_type_id( "fd_fire" ), 1 );
+    CHECK( changed() );
+    item &rock = here.add_item( p + tripoint_north, item( "rock" ) );
+    CHECK( changed() );
+    here.i_rem( p + tripoint_north, &rock );
+    CHECK( changed() );
+    here.set_graffiti( p + tripoint_north, "test" );
+    CHECK( changed() );
+    here.add_vehicle( vproto_id( "bicycle" ), p + tripoint( 5, 5, 0 ), 0_degrees, 0, 0 );
+    CHECK( changed() );
+    clear_map();
 }
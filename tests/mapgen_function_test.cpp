@@ -1,6 +1,24 @@
+#include <set>
+#include <string>
+#include <vector>
+
 #include "cata_catch.h"
 
+#include "cached_options.h"
+#include "calendar.h"
+#include "coordinates.h"
+#include "item.h"
+#include "map.h"
+#include "mapbuffer.h"
+#include "mapdata.h"
 #include "mapgen.h"
+#include "mapgen_functions.h"
+#include "mapgendata.h"
+#include "omdata.h"
+#include "overmapbuffer.h"
+#include "point.h"
+#include "rng.h"
+#include "trap.h"
 #include "type_id.h"
 
 TEST_CASE( "connects_to", "[mapgen][connects]" )
@@ -88,3 +106,140 @@ TEST_CASE( "connects_to", "[mapgen][connects]" )
         CHECK( connects_to( oter_id( "sewer_nesw" ), west ) );
     }
 }
+
+static void generate_terrain( map &m, const oter_id &ter, const unsigned int seed )
+{
+    rng_set_engine_seed( seed );
+    const mapgendata base( tripoint_abs_omt( 0, 0, 0 ), m, 0.0f, calendar::turn, nullptr );
+    mapgendata md( base, ter );
+    REQUIRE( run_mapgen_func( md.terrain_type()->get_mapgen_id(), md ) );
+}
+
+static void generate_house( map &m, const unsigned int seed )
+{
+    generate_terrain( m, oter_id( "house_01_north" ), seed );
+}
+
+static std::string describe_tile( map &m, const point &p )
+{
+    std::string tile = m.ter( p ).id().str() + " " + m.furn( p ).id().str();
+    for( const item &it : m.i_at( p ) ) {
+        tile += " " + it.typeId().str();
+    }
+    return tile;
+}
+
+TEST_CASE( "compiled_json_mapgen_places_the_same_as_uncompiled", "[mapgen]" )
+{
+    // Both use "rows", place single cells over them and have objects placed at random, like
+    // items and monsters, between the compiled runs.
+    const std::string terrain = GENERATE( "house_01_north", "s_gun_north" );
+    const unsigned int seed = GENERATE( 1234u, 77u );
+    CAPTURE( terrain, seed );
+
+    fake_map compiled( f_null, t_dirt, tr_null, 0 );
+    fake_map uncompiled( f_null, t_dirt, tr_null, 0 );
+    generate_terrain( compiled, oter_id( terrain ), seed );
+    test_mode_uncompiled_mapgen = true;
+    generate_terrain( uncompiled, oter_id( terrain ), seed );
+    test_mode_uncompiled_mapgen = false;
+
+    int walls = 0;
+    int furniture = 0;
+    for( int x = 0; x < SEEX * 2; x++ ) {
+        for( int y = 0; y < SEEY * 2; y++ ) {
+            const point p( x, y );
+            CAPTURE( p );
+            CHECK( describe_tile( compiled, p ) == describe_tile( uncompiled, p ) );
+            CHECK( compiled.ter( p ) != t_null );
+            if( compiled.has_flag_ter( TFLAG_WALL, p ) ) {
+                walls++;
+                // walls clear the furniture under them
+                CHECK( compiled.furn( p ) == f_null );
+            }
+            if( compiled.furn( p ) != f_null ) {
+                furniture++;
+            }
+        }
+    }
+    CHECK( walls > 0 );
+    CHECK( furniture > 0 );
+}
+
+TEST_CASE( "mapgen_seed_differs_for_neighbouring_places", "[mapgen]" )
+{
+    // a plain polynomial of the coordinates gives these the same seed
+    CHECK( mapgen_seed( tripoint_abs_omt( 10, 40, 0 ) ) != mapgen_seed( tripoint_abs_omt( 11, 9, 0 ) ) );
+    CHECK( mapgen_seed( tripoint_abs_omt( 10, 10, 0 ) ) != mapgen_seed( tripoint_abs_omt( 10, 11, -31 ) ) );
+
+    std::set<unsigned int> seeds;
+    for( int x = 0; x < 20; x++ ) {
+        for( int y = 0; y < 20; y++ ) {
+            const tripoint_abs_omt p( x, y, 0 );
+            CHECK( mapgen_seed( p ) == mapgen_seed( p ) );
+            seeds.insert( mapgen_seed( p ) );
+        }
+    }
+    CHECK( seeds.size() == 400 );
+}
+
+struct mapbuffer_test_helper {
+    static void remove_submap( const tripoint &p ) {
+        MAPBUFFER.remove_submap( p );
+    }
+};
+
+static std::vector<std::string> generate_omt( const tripoint_abs_omt &omt )
+{
+    const tripoint_abs_sm sm = project_to<coords::sm>( omt );
+    tinymap tm;
+    tm.load( sm, false );
+    std::vector<std::string> result;
+    for( int x = 0; x < SEEX * 2; x++ ) {
+        for( int y = 0; y < SEEY * 2; y++ ) {
+            const tripoint p( x, y, omt.z() );
+            std::string tile = tm.ter( p ).id().str() + " " + tm.furn( p ).id().str() + " " +
+                               tm.tr_at( p ).id.str();
+            for( const item &it : tm.i_at( p ) ) {
+                tile += " " + it.typeId().str();
+            }
+            result.push_back( tile );
+        }
+    }
+    // drop the submaps, so the next load generates them again
+    for( int x = 0; x < 2; x++ ) {
+        for( int y = 0; y < 2; y++ ) {
+            mapbuffer_test_helper::remove_submap( sm.raw() + tripoint( x, y, 0 ) );
+        }
+    }
+    return result;
+}
+
+TEST_CASE( "mapgen_generates_the_same_place_the_same_way", "[mapgen]" )
+{
+    const tripoint_abs_omt omt( 170, 30, 0 );
+    const oter_id old_terrain = overmap_buffer.ter( omt );
+    overmap_buffer.ter_set( omt, oter_id( "house_01_north" ) );
+    generate_omt( omt );
+
+    // whatever was generated in between must not matter
+    const std::vector<std::string> first = generate_omt( omt );
+    generate_omt( omt + point_east );
+    const std::vector<std::string> second = generate_omt( omt );
+    REQUIRE( first.size() == second.size() );
+    for( size_t i = 0; i < first.size(); i++ ) {
+        CAPTURE( i );
+        CHECK( first[i] == second[i] );
+    }
+    overmap_buffer.ter_set( omt, old_terrain );
+}
+
+TEST_CASE( "json_mapgen_benchmark", "[.][mapgen][benchmark]" )
+{
+    unsigned int seed = 0;
+    BENCHMARK( "house_01" ) {
+        fake_map m( f_null, t_dirt, tr_null, 0 );
+        generate_house( m, seed++ % 1000 );
+        return m.ter( point_zero );
+    };
+}
@@ -1,11 +1,19 @@
+#include <functional>
+#include <vector>
+
 #include "cached_options.h"
 #include "calendar.h"
 #include "cata_catch.h"
+#include "game.h"
+#include "line.h"
 #include "map.h"
+#include "map_iterator.h"
 #include "map_helpers.h"
 #include "mapdata.h"
 #include "monster.h"
+#include "npc.h"
 #include "options_helpers.h"
+#include "player_helpers.h"
 
 struct tripoint;
 
@@ -73,3 +81,97 @@ TEST_CASE( "monsters shouldn't see through floors", "[vision]" )
     CHECK( sky.sees( distant ) );
     CHECK( distant.sees( sky ) );
 }
+
+TEST_CASE( "monsters_and_npcs_see_each_other_through_the_npc_field_of_view", "[vision]" )
+{
+    calendar::turn = midday;
+    clear_map();
+    clear_npcs();
+    g->reset_light_level();
+    map &here = get_map();
+    const tripoint npc_pos( 50, 50, 0 );
+    npc &guy = spawn_npc( npc_pos.xy(), "test_talker" );
+    monster &zombie = spawn_test_monster( "mon_zombie", npc_pos + point( 2, 6 ) );
+    here.build_map_cache( 0 );
+
+    CHECK( zombie.sees( guy ) );
+    CHECK( guy.sees( zombie ) );
+
+    for( int x = 45; x <= 55; ++x ) {
+        here.ter_set( tripoint( x, 53, 0 ), t_wall );
+    }
+    here.build_map_cache( 0 );
+    CHECK_FALSE( zombie.sees( guy ) );
+    CHECK_FALSE( guy.sees( zombie ) );
+    CHECK( here.sees_with_fov( npc_pos, npc_pos + point( 2, 2 ), 60 ) );
+    CHECK_FALSE( here.sees_with_fov( npc_pos, npc_pos + point( 2, 6 ), 60 ) );
+    CHECK_FALSE( here.sees_with_fov( npc_pos, npc_pos + point( 2, 2 ), 1 ) );
+
+    here.ter_set( tripoint( 52, 53, 0 ), t_floor );
+    here.ter_set( tripoint( 51, 53, 0 ), t_floor );
+    here.build_map_cache( 0 );
+    CHECK( zombie.sees( guy ) );
+    CHECK( guy.sees( zombie ) );
+}
+
+TEST_CASE( "field_of_view_agrees_with_line_of_sight_away_from_corners", "[vision]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint origin( 60, 60, 0 );
+    const int range = 20;
+    const auto check_all = [&]( const std::function<bool( const tripoint & )> &expected ) {
+        here.build_map_cache( 0 );
+        for( const tripoint &p : here.points_in_radius( origin, range + 2 ) ) {
+            CAPTURE( p );
+            CHECK( here.sees_with_fov( origin, p, range ) == expected( p ) );
+            CHECK( here.sees( origin, p, range ) == expected( p ) );
+        }
+    };
+
+    // open ground
+    check_all( [&]( const tripoint & p ) {
+        return rl_dist( origin, p ) <= range;
+    } );
+
+    // a closed room, its walls are seen but nothing outside of them
+    for( const tripoint &p : here.points_in_radius( origin, 5 ) ) {
+        if( square_dist( origin, p ) == 5 ) {
+            here.ter_set( p, t_wall );
+        }
+    }
+    check_all( [&]( const tripoint & p ) {
+        return square_dist( origin, p ) <= 5;
+    } );
+    clear_map();
+}
+
+TEST_CASE( "monsters_looking_at_an_npc_benchmark", "[.][vision][benchmark]" )
+{
+    calendar::turn = midday;
+    clear_map();
+    clear_npcs();
+    g->reset_light_level();
+    map &here = get_map();
+    npc &guy = spawn_npc( point( 60, 60 ), "test_talker" );
+    std::vector<monster *> zombies;
+    for( int x = 40; x <= 80; x += 4 ) {
+        for( int y = 40; y <= 80; y += 4 ) {
+            if( x % 12 == 0 ) {
+                here.ter_set( tripoint( x, y + 1, 0 ), t_wall );
+            }
+            if( tripoint( x, y, 0 ) != guy.pos() ) {
+                zombies.push_back( &spawn_test_monster( "mon_zombie", tripoint( x, y, 0 ) ) );
+            }
+        }
+    }
+    here.build_map_cache( 0 );
+
+    BENCHMARK( "monster::sees( npc )" ) {
+        int seen = 0;
+        for( const monster *zombie : zombies ) {
+            seen += zombie->sees( guy );
+        }
+        return seen;
+    };
+}
@@ -20,6 +20,7 @@
 #include "memory_fast.h"
 #include "npc.h"
 #include "npc_class.h"
+#include "npctalk.h"
 #include "optional.h"
 #include "overmapbuffer.h"
 #include "pimpl.h"
@@ -450,3 +451,44 @@ TEST_CASE( "npc_can_target_player" )
     REQUIRE( hostile.current_target() != nullptr );
     CHECK( hostile.current_target() == static_cast<Creature *>( &player_character ) );
 }
+
+TEST_CASE( "npc_item_search_benchmark", "[.][npc][benchmark]" )
+{
+    calendar::turn = calendar::turn_zero + 12_hours;
+    g->faction_manager_ptr->create_if_needed();
+
+    clear_map();
+    clear_npcs();
+    clear_creatures();
+    g->place_player( tripoint_zero );
+
+    Character &player_character = get_player_character();
+    std::vector<npc *> followers;
+    for( int i = 0; i < 5; i++ ) {
+        npc &guy = spawn_npc( player_character.pos().xy() + point( 2 * i - 4, 3 ), "test_talker" );
+        talk_function::follow( guy );
+        guy.rules.set_flag( ally_rule::allow_pick_up );
+        followers.push_back( &guy );
+    }
+
+    map &here = get_map();
+    for( const tripoint &p : here.points_in_radius( player_character.pos(), 8 ) ) {
+        if( ( p.x + p.y ) % 3 == 0 ) {
+            here.add_item_or_charges( p, item( "test_balanced_sword" ) );
+        }
+    }
+
+    size_t i = 0;
+    BENCHMARK( "npc::find_item" ) {
+        npc &guy = *followers[i++ % followers.size()];
+        guy.find_item();
+        return guy.wanted_item_pos;
+    };
+
+    // Dead NPCs stay in the follower list
+    for( const npc *guy : followers ) {
+        g->remove_npc_follower( guy->getID() );
+    }
+    clear_npcs();
+    clear_map();
+}
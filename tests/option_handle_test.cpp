@@ -0,0 +1,32 @@
+#include <string>
+
+#include "cata_catch.h"
+#include "options.h"
+#include "options_helpers.h"
+
+TEST_CASE( "option_handle_follows_option_changes", "[options]" )
+{
+    static const option_handle<int> autosave_turns( "AUTOSAVE_TURNS" );
+    static const option_handle<std::string> use_celsius( "USE_CELSIUS" );
+    CHECK( autosave_turns.get() == get_option<int>( "AUTOSAVE_TURNS" ) );
+
+    {
+        override_option turns( "AUTOSAVE_TURNS", "42" );
+        override_option celsius( "USE_CELSIUS", "kelvin" );
+        CHECK( autosave_turns.get() == 42 );
+        CHECK( use_celsius.get() == "kelvin" );
+    }
+    CHECK( autosave_turns.get() == get_option<int>( "AUTOSAVE_TURNS" ) );
+    CHECK( use_celsius.get() == get_option<std::string>( "USE_CELSIUS" ) );
+}
+
+TEST_CASE( "option_handle_benchmark", "[.][options][benchmark]" )
+{
+    static const option_handle<float> spawn_density( "SPAWN_DENSITY" );
+    BENCHMARK( "get_option" ) {
+        return get_option<float>( "SPAWN_DENSITY" );
+    };
+    BENCHMARK( "option_handle" ) {
+        return spawn_density.get();
+    };
+}
@@ -16,12 +16,16 @@ override_option::~override_option()
     get_options().get_option( option_ ).setValue( old_value_ );
 }
 
-scoped_weather_override::scoped_weather_override( const weather_type_id &weather )
+scoped_weather_override::scoped_weather_override( const weather_type_id &weather ) :
+    old_weather_( get_weather().weather_id )
 {
     get_weather().weather_override = weather;
 }
 
 scoped_weather_override::~scoped_weather_override()
 {
-    get_weather().weather_override = WEATHER_NULL;
+    weather_manager &weather = get_weather();
+    weather.weather_override = WEATHER_NULL;
+    // The override may have been applied by an update in the meantime
+    weather.weather_id = old_weather_;
 }
@@ -19,8 +19,8 @@ class override_option
         std::string old_value_;
 };
 
-// RAII class to temporarily override the game's weather and restore it to
-// default weather in the destructor.
+// RAII class to temporarily override the game's weather and restore the
+// previous weather in the destructor.
 class scoped_weather_override
 {
     public:
@@ -28,6 +28,8 @@ class scoped_weather_override
         scoped_weather_override( const scoped_weather_override & ) = delete;
         scoped_weather_override &operator=( const scoped_weather_override & ) = delete;
         ~scoped_weather_override();
+    private:
+        weather_type_id old_weather_;
 };
 
 #endif // CATA_TESTS_OPTIONS_HELPERS_H
@@ -1,4 +1,8 @@
+#include <algorithm>
 #include <memory>
+#include <set>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "calendar.h"
@@ -7,10 +11,12 @@
 #include "coordinates.h"
 #include "enums.h"
 #include "game_constants.h"
+#include "line.h"
 #include "omdata.h"
 #include "overmap.h"
 #include "overmap_types.h"
 #include "overmapbuffer.h"
+#include "point.h"
 #include "type_id.h"
 
 TEST_CASE( "set_and_get_overmap_scents" )
@@ -107,6 +113,190 @@ TEST_CASE( "default_overmap_generation_has_non_mandatory_specials_at_origin", "[
     CHECK( found_optional == true );
 }
 
+struct overmapbuffer_test_helper {
+    static void discard( const point_abs_om &p ) {
+        overmap_buffer.discard( p );
+    }
+};
+
+TEST_CASE( "pregenerate_adjacent_overmaps", "[overmap][slow]" )
+{
+    const point_abs_om om( 40, -40 );
+    const auto omt_in_om = [&om]( const int x, const int y ) {
+        return tripoint_abs_omt( om.x() * OMAPX + x, om.y() * OMAPY + y, 0 );
+    };
+    const int margin = 10;
+    // generating an overmap can place specials into overmaps up to two away from it
+    const std::vector<point_abs_om> nearby = closest_points_first( om, 3 );
+    for( const point_abs_om &p : nearby ) {
+        REQUIRE_FALSE( overmap_buffer.has( p ) );
+    }
+
+    // nothing to prepare in the middle of an overmap
+    CHECK_FALSE( overmap_buffer.pregenerate_adjacent( omt_in_om( OMAPX / 2, OMAPY / 2 ), margin ) );
+
+    // close to a border only the overmap on the other side is generated, once
+    CHECK( overmap_buffer.pregenerate_adjacent( omt_in_om( OMAPX - 5, OMAPY / 2 ), margin ) );
+    CHECK( overmap_buffer.has( om + point_east ) );
+    CHECK_FALSE( overmap_buffer.pregenerate_adjacent( omt_in_om( OMAPX - 5, OMAPY / 2 ), margin ) );
+
+    // close to a corner both sides and the diagonal are generated, one at a time
+    // (mandatory specials may already have been placed into some of them)
+    int generated = 0;
+    while( overmap_buffer.pregenerate_adjacent( omt_in_om( OMAPX - 5, 2 ), margin ) ) {
+        ++generated;
+        REQUIRE( generated <= 2 );
+    }
+    CHECK( overmap_buffer.has( om + point_north ) );
+    CHECK( overmap_buffer.has( om + point_north_east ) );
+
+    // with a heading only the overmaps ahead are generated, checked on the south side which
+    // the specials placed so far can not have reached
+    CHECK_FALSE( overmap_buffer.has( om + point( 0, 3 ) ) );
+    CHECK_FALSE( overmap_buffer.pregenerate_adjacent( omt_in_om( OMAPX / 2, OMAPY * 3 - 5 ),
+                 margin, point_north ) );
+    CHECK_FALSE( overmap_buffer.has( om + point( 0, 3 ) ) );
+    CHECK( overmap_buffer.pregenerate_adjacent( omt_in_om( OMAPX / 2, OMAPY * 3 - 5 ), margin,
+                                                point_south ) );
+    CHECK( overmap_buffer.has( om + point( 0, 3 ) ) );
+
+    // later tests do not expect these overmaps
+    for( const point_abs_om &p : closest_points_first( om, 5 ) ) {
+        overmapbuffer_test_helper::discard( p );
+    }
+}
+
+static std::set<tripoint_om_omt> scan_for_terrain( const overmap &om,
+        const std::pair<std::string, ot_match_type> &target )
+{
+    std::set<tripoint_om_omt> result;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const tripoint_om_omt p( x, y, z );
+                if( is_ot_match( target.first, om.ter( p ), target.second ) ) {
+                    result.insert( p );
+                }
+            }
+        }
+    }
+    return result;
+}
+
+TEST_CASE( "overmap_terrain_index_matches_scan", "[overmap][terrain]" )
+{
+    overmap &om = overmap_buffer.get( point_abs_om() );
+    const std::vector<std::pair<std::string, ot_match_type>> targets = {
+        { "field", ot_match_type::exact },
+        { "road", ot_match_type::type },
+        { "house", ot_match_type::prefix },
+        { "forest", ot_match_type::contains },
+        { "road_ns", ot_match_type::exact },
+        { "empty_rock", ot_match_type::type },
+        { "open_air", ot_match_type::exact },
+    };
+    for( const std::pair<std::string, ot_match_type> &target : targets ) {
+        INFO( target.first );
+        const std::vector<tripoint_om_omt> found = om.find_all_omt( target );
+        const std::set<tripoint_om_omt> found_set( found.begin(), found.end() );
+        CHECK( found_set.size() == found.size() );
+        CHECK( found_set == scan_for_terrain( om, target ) );
+    }
+
+    // changed terrain is found at once
+    const tripoint_om_omt p( 10, 10, 0 );
+    const std::pair<std::string, ot_match_type> lab( "lab", ot_match_type::type );
+    const oter_id old_ter = om.ter( p );
+    const std::vector<tripoint_om_omt> labs_before = om.find_all_omt( lab );
+    REQUIRE( std::find( labs_before.begin(), labs_before.end(), p ) == labs_before.end() );
+    om.ter_set( p, oter_id( "lab" ) );
+    const std::vector<tripoint_om_omt> labs_after = om.find_all_omt( lab );
+    CHECK( labs_after.size() == labs_before.size() + 1 );
+    CHECK( std::find( labs_after.begin(), labs_after.end(), p ) != labs_after.end() );
+    om.ter_set( p, old_ter );
+    CHECK( om.find_all_omt( lab ).size() == labs_before.size() );
+
+    // removing a place keeps the others, filler terrain included
+    const std::vector<tripoint_om_omt> places = {
+        tripoint_om_omt( 11, 10, 0 ), tripoint_om_omt( 12, 10, -1 ), tripoint_om_omt( 13, 10, 1 )
+    };
+    std::vector<oter_id> old_ters;
+    for( const tripoint_om_omt &place : places ) {
+        old_ters.push_back( om.ter( place ) );
+        om.ter_set( place, oter_id( "lab" ) );
+    }
+    om.ter_set( places[0], old_ters[0] );
+    const std::vector<tripoint_om_omt> labs_left = om.find_all_omt( lab );
+    CHECK( labs_left.size() == labs_before.size() + 2 );
+    CHECK( std::find( labs_left.begin(), labs_left.end(), places[0] ) == labs_left.end() );
+    CHECK( std::find( labs_left.begin(), labs_left.end(), places[1] ) != labs_left.end() );
+    CHECK( std::find( labs_left.begin(), labs_left.end(), places[2] ) != labs_left.end() );
+    for( size_t i = 1; i < places.size(); i++ ) {
+        om.ter_set( places[i], old_ters[i] );
+    }
+    CHECK( om.find_all_omt( lab ).size() == labs_before.size() );
+    for( const std::pair<std::string, ot_match_type> &target : targets ) {
+        INFO( target.first );
+        const std::vector<tripoint_om_omt> found = om.find_all_omt( target );
+        CHECK( std::set<tripoint_om_omt>( found.begin(), found.end() ) == scan_for_terrain( om, target ) );
+    }
+
+    // the searches of the overmap buffer use the index too, but only for terrain that is not
+    // filler, otherwise a search in a small range would look at every place of the overmap
+    const std::pair<std::string, ot_match_type> field( "field", ot_match_type::type );
+    CHECK( om.is_indexed_terrain( lab ) );
+    CHECK( om.is_indexed_terrain( { "road", ot_match_type::type } ) );
+    CHECK_FALSE( om.is_indexed_terrain( field ) );
+    CHECK_FALSE( om.is_indexed_terrain( { "empty_rock", ot_match_type::type } ) );
+    const tripoint_abs_omt origin( 90, 90, 0 );
+    const tripoint_abs_omt closest = overmap_buffer.find_closest( origin, "field", 0, false );
+    REQUIRE( closest != overmap::invalid_tripoint );
+    const int closest_dist = square_dist( origin, closest );
+    for( const tripoint_om_omt &f : scan_for_terrain( om, field ) ) {
+        CHECK( square_dist( origin, project_combine( point_abs_om(), f ) ) >= closest_dist );
+    }
+    omt_find_params params;
+    params.types.push_back( field );
+    params.search_range = 20;
+    const std::vector<tripoint_abs_omt> fields = overmap_buffer.find_all( origin, params );
+    size_t expected = 0;
+    for( const tripoint_om_omt &f : scan_for_terrain( om, field ) ) {
+        if( f.z() == 0 && square_dist( origin.xy(), project_combine( point_abs_om(), f ).xy() ) <= 20 ) {
+            ++expected;
+        }
+    }
+    CHECK( fields.size() == expected );
+}
+
+TEST_CASE( "overmap_filler_search_stays_in_range", "[overmap][terrain]" )
+{
+    overmap &om = overmap_buffer.get( point_abs_om() );
+    const std::pair<std::string, ot_match_type> field( "field", ot_match_type::type );
+    // filler is not indexed, so the search only looks at the places in range
+    REQUIRE_FALSE( om.is_indexed_terrain( field ) );
+    const tripoint_abs_omt origin( 90, 90, 0 );
+    omt_find_params params;
+    params.types.push_back( field );
+    params.search_range = 2;
+    params.existing_only = true;
+    const std::vector<tripoint_abs_omt> fields = overmap_buffer.find_all( origin, params );
+    std::set<tripoint_abs_omt> expected;
+    for( const tripoint_om_omt &f : scan_for_terrain( om, field ) ) {
+        const tripoint_abs_omt p = project_combine( point_abs_om(), f );
+        if( f.z() == 0 && square_dist( origin.xy(), p.xy() ) <= 2 ) {
+            expected.insert( p );
+        }
+    }
+    CHECK( std::set<tripoint_abs_omt>( fields.begin(), fields.end() ) == expected );
+
+    const tripoint_abs_omt closest = overmap_buffer.find_closest( origin, params );
+    if( expected.empty() ) {
+        CHECK( closest == overmap::invalid_tripoint );
+    } else {
+        CHECK( expected.count( closest ) == 1 );
+    }
+}
+
 TEST_CASE( "is_ot_match", "[overmap][terrain]" )
 {
     SECTION( "exact match" ) {
@@ -1,4 +1,5 @@
 #include <array>
+#include <cmath>
 #include <functional>
 #include <iosfwd>
 
@@ -6,6 +7,7 @@
 #include "cata_catch.h"
 #include "character.h"
 #include "item.h"
+#include "player_helpers.h"
 #include "type_id.h"
 #include "weather.h"
 
@@ -126,3 +128,59 @@ TEST_CASE( "player body temperatures converge on expected values.", "[.bodytemp]
         test_temperature_spread( &dummy, {{ -115, -87, -54, -6, 36, 64, 80 }} );
     }
 }
+
+TEST_CASE( "clothing_warmth_follows_worn_items", "[bodytemp]" )
+{
+    clear_avatar();
+    Character &dummy = get_player_character();
+    const bodypart_id torso( "torso" );
+    REQUIRE( dummy.warmth( torso ) == 0 );
+    REQUIRE( dummy.get_wind_resistance( torso ) == 0 );
+
+    const item tshirt( "tshirt", calendar::turn_zero );
+    REQUIRE( dummy.wear_item( tshirt ) );
+    CHECK( dummy.warmth( torso ) == tshirt.get_warmth() );
+    const int tshirt_wind_resistance = dummy.get_wind_resistance( torso );
+    CHECK( tshirt_wind_resistance > 0 );
+
+    // Clothing mods applied to a worn item are noticed too
+    item &worn_tshirt = dummy.worn.back();
+    worn_tshirt.set_flag( flag_id( "furred" ) );
+    worn_tshirt.update_clothing_mod_val();
+    REQUIRE( worn_tshirt.get_warmth() > tshirt.get_warmth() );
+    CHECK( dummy.warmth( torso ) == worn_tshirt.get_warmth() );
+    worn_tshirt.unset_flag( flag_id( "furred" ) );
+    worn_tshirt.update_clothing_mod_val();
+    CHECK( dummy.warmth( torso ) == tshirt.get_warmth() );
+
+    // Worn items added directly are noticed too
+    dummy.worn.emplace_back( "sweater" );
+    const int sweater_warmth = dummy.worn.back().get_warmth();
+    CHECK( dummy.warmth( torso ) == tshirt.get_warmth() + sweater_warmth );
+    CHECK( dummy.get_wind_resistance( torso ) > tshirt_wind_resistance );
+
+    // The wool sweater keeps its warmth when wet
+    dummy.set_part_wetness( torso, dummy.get_part_drench_capacity( torso ) );
+    CHECK( dummy.warmth( torso ) == std::round( tshirt.get_warmth() * ( 1.0 - 0.66 ) ) +
+           sweater_warmth );
+
+    dummy.worn.clear();
+    CHECK( dummy.warmth( torso ) == 0 );
+    CHECK( dummy.get_wind_resistance( torso ) == 0 );
+}
+
+TEST_CASE( "update_bodytemp_benchmark", "[.][bodytemp][benchmark]" )
+{
+    clear_avatar();
+    Character &dummy = get_player_character();
+    for( const char *clothing : {
+             "hat_knit", "tshirt", "vest", "trenchcoat", "gloves_wool", "long_underpants",
+             "pants_army", "socks_wool", "boots"
+         } ) {
+        equip_clothing( &dummy, clothing );
+    }
+    BENCHMARK( "update_bodytemp" ) {
+        dummy.update_bodytemp();
+        return dummy.get_part_temp_conv( bodypart_id( "torso" ) );
+    };
+}
@@ -1,3 +1,4 @@
+#include <set>
 #include <sstream>
 #include <string>
 
@@ -6,6 +7,7 @@
 #include "character.h"
 #include "json.h"
 #include "recipe.h"
+#include "recipe_dictionary.h"
 #include "requirements.h"
 #include "type_id.h"
 
@@ -69,3 +71,23 @@ TEST_CASE( "blueprint_autocalc_with_components", "[recipe][blueprint]" )
     CHECK( reqs_to_json_string( stove_3->simple_requirements() ) ==
            R"({"tools":[],"qualities":[[{"id":"CUT"}]],"components":[[["pipe",2],["scrap",1]]]})" );
 }
+
+TEST_CASE( "recipe_requirement_users", "[recipe]" )
+{
+    const recipe *stove_1 = &recipe_id( "test_base_stove_1" ).obj();
+    const recipe *stove_plus_pipe_3 = &recipe_id( "test_base_stove_plus_pipe_3" ).obj();
+
+    const std::set<const recipe *> &tank_users = recipe_dict.using_item( itype_id( "metal_tank" ) );
+    CHECK( tank_users.count( stove_1 ) == 1 );
+    CHECK( tank_users.count( stove_plus_pipe_3 ) == 0 );
+
+    const std::set<const recipe *> &scrap_users = recipe_dict.using_item( itype_id( "scrap" ) );
+    CHECK( scrap_users.count( stove_1 ) == 0 );
+    CHECK( scrap_users.count( stove_plus_pipe_3 ) == 1 );
+
+    const std::set<const recipe *> &saw_users = recipe_dict.using_quality( quality_id( "SAW_M" ) );
+    CHECK( saw_users.count( stove_1 ) == 1 );
+    CHECK( saw_users.count( stove_plus_pipe_3 ) == 0 );
+
+    CHECK( recipe_dict.using_item( itype_id( "nonexistent_item" ) ).empty() );
+}
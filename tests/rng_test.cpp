@@ -78,3 +78,37 @@ TEST_CASE( "random_entry_preserves_constness" )
     i1 = 5678;
     CHECK( v1[0] == 5678 );
 }
+
+TEST_CASE( "scoped_rng_stream_is_deterministic_and_restores_the_engine", "[rng]" )
+{
+    const auto draw = []() {
+        std::vector<int> result;
+        for( int i = 0; i < 10; i++ ) {
+            result.push_back( rng( 0, 1000000 ) );
+        }
+        return result;
+    };
+
+    rng_set_engine_seed( 1234 );
+    const std::vector<int> outside = draw();
+
+    rng_set_engine_seed( 1234 );
+    std::vector<int> first_stream;
+    {
+        const scoped_rng_stream stream( 42 );
+        first_stream = draw();
+    }
+    // the numbers drawn in the stream don't affect the numbers outside of it
+    CHECK( draw() == outside );
+
+    // the same seed gives the same numbers, whatever the state of the engine was
+    rng_set_engine_seed( 999 );
+    {
+        const scoped_rng_stream stream( 42 );
+        CHECK( draw() == first_stream );
+    }
+    {
+        const scoped_rng_stream stream( 43 );
+        CHECK( draw() != first_stream );
+    }
+}
@@ -0,0 +1,69 @@
+#include "sdl_font.h"
+
+#if defined(TILES)
+
+#include <string>
+
+#include "cata_catch.h"
+#include "sdltiles.h"
+#include "sdl_wrappers.h"
+
+// Draws a full terminal of text the way draw_window does, one character per cell with the
+// colors changing from cell to cell, into a software renderer so no window is needed.
+static void run_redraw_benchmark( const bool batched )
+{
+    static constexpr int columns = 80;
+    static constexpr int rows = 24;
+    static constexpr int font_width = 8;
+    static constexpr int font_height = 16;
+
+    REQUIRE( TTF_Init() == 0 );
+    const palette_array saved_palette = windowsPalette;
+    for( size_t i = 0; i < windowsPalette.size(); ++i ) {
+        const Uint8 c = static_cast<Uint8>( 64 + i * 8 );
+        windowsPalette[i] = SDL_Color{ c, static_cast<Uint8>( 255 - c ), c, 255 };
+    }
+    {
+        const SDL_Surface_Ptr target = CreateRGBSurface( 0, columns * font_width,
+                                       rows * font_height, 32, 0xff0000, 0xff00, 0xff, 0xff000000 );
+        REQUIRE( target );
+        const SDL_Renderer_Ptr renderer( SDL_CreateSoftwareRenderer( target.get() ) );
+        REQUIRE( renderer );
+        const GeometryRenderer_Ptr geometry( new DefaultGeometryRenderer() );
+        CachedTTFFont font( font_width, font_height, windowsPalette, "Terminus.ttf", 0, true );
+
+        const std::string glyphs = "abcdefghijklmnopqrstuvwxyz#.@+<>";
+        BENCHMARK( batched ? "batched" : "one glyph at a time" ) {
+            RenderClear( renderer );
+            if( batched ) {
+                font.begin_batch();
+            }
+            for( int y = 0; y < rows; ++y ) {
+                for( int x = 0; x < columns; ++x ) {
+                    const std::string ch( 1, glyphs[( x + y * 7 ) % glyphs.size()] );
+                    const unsigned char color = ( x / 3 + y ) % 16;
+                    font.OutputChar( renderer, geometry, ch,
+                                     point( x * font_width, y * font_height ), color );
+                }
+            }
+            if( batched ) {
+                font.end_batch( renderer );
+            }
+            return static_cast<Uint32 *>( target->pixels )[0];
+        };
+    }
+    windowsPalette = saved_palette;
+    TTF_Quit();
+}
+
+TEST_CASE( "full_screen_text_redraw_benchmark", "[.][sdl_font][benchmark]" )
+{
+    SECTION( "batched" ) {
+        run_redraw_benchmark( true );
+    }
+    SECTION( "unbatched" ) {
+        run_redraw_benchmark( false );
+    }
+}
+
+#endif
@@ -55,6 +55,39 @@ TEST_CASE( "stats_tracker_count_events", "[stats]" )
     CHECK( s.get_events( event_type::character_kills_monster ).count( char_is_player ) == 2 );
 }
 
+TEST_CASE( "event_multiset_groups_inline_and_data_map_events", "[stats]" )
+{
+    const mtype_id mon1( "mon_zombie" );
+    const mtype_id mon2( "mon_zombie_brute" );
+    const cata::event kill1 =
+        cata::event::make<event_type::character_kills_monster>( character_id( 5 ), mon1 );
+    const cata::event kill2 =
+        cata::event::make<event_type::character_kills_monster>( character_id( 5 ), mon2 );
+    cata::event::data_type data = kill1.data();
+    const cata::event kill1_from_data( kill1.type(), kill1.time(), std::move( data ) );
+    REQUIRE( kill1_from_data.values() == nullptr );
+    REQUIRE( kill1.values() != nullptr );
+
+    event_multiset events( event_type::character_kills_monster );
+    events.add( kill1 );
+    events.add( kill1_from_data );
+    events.add( cata::event::make<event_type::character_kills_monster>( character_id( 5 ), mon1 ) );
+    events.add( kill2 );
+    CHECK( events.counts().size() == 2 );
+    CHECK( events.count( kill1.data() ) == 3 );
+    CHECK( events.count( kill2.data() ) == 1 );
+
+    // copies keep counting into their own summaries
+    event_multiset copy = events;
+    copy.add( kill2 );
+    CHECK( copy.count( kill2.data() ) == 2 );
+    CHECK( events.count( kill2.data() ) == 1 );
+    events = copy;
+    events.add( kill1 );
+    CHECK( events.count( kill1.data() ) == 4 );
+    CHECK( copy.count( kill1.data() ) == 3 );
+}
+
 TEST_CASE( "stats_tracker_total_events", "[stats]" )
 {
     stats_tracker s;
@@ -313,3 +313,13 @@ TEST_CASE( "hunger" )
     CHECK( hunger_time <= 240 );
     CHECK( hunger_time >= 180 );
 }
+
+TEST_CASE( "update_body_benchmark", "[.][stomach][benchmark]" )
+{
+    reset_time();
+    Character &dummy = get_player_character();
+    BENCHMARK( "eight hours" ) {
+        pass_time( dummy, 8_hours );
+        return dummy.get_hunger();
+    };
+}
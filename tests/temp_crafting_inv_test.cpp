@@ -39,3 +39,30 @@ TEST_CASE( "temp_crafting_inv_test_quality", "[crafting][inventory]" )
 
     CHECK( inv.max_quality( quality_id( "PRY" ) ) == 4 );
 }
+
+TEST_CASE( "temp_crafting_inv_test_binned_counts", "[crafting][inventory]" )
+{
+    temp_crafting_inventory inv;
+    item gum( "test_gum", calendar::turn_zero, item::default_charges_tag{} );
+    item rock( "test_rock" );
+
+    inv.add_item_ref( gum );
+    inv.add_item_ref( rock );
+    CHECK( inv.count_item( itype_id( "test_gum" ) ) == 10 );
+    CHECK( inv.count_item( itype_id( "test_rock" ) ) == 1 );
+    CHECK( inv.charges_of( itype_id( "test_gum" ) ) == 10 );
+    CHECK( inv.charges_of( itype_id( "test_gum" ), 4 ) == 4 );
+
+    // adding an item invalidates the counts
+    inv.add_item_copy( rock );
+    CHECK( inv.count_item( itype_id( "test_rock" ) ) == 2 );
+    CHECK( inv.amount_of( itype_id( "test_rock" ) ) == 2 );
+    CHECK( inv.amount_of( itype_id( "test_rock" ), true, 1 ) == 1 );
+
+    // references are not copies
+    gum.charges = 3;
+    CHECK( inv.charges_of( itype_id( "test_gum" ) ) == 3 );
+
+    inv.clear();
+    CHECK( inv.count_item( itype_id( "test_rock" ) ) == 0 );
+}
@@ -124,6 +124,67 @@ TEST_CASE( "vehicle power with reactor and solar panels", "[vehicle][power]" )
     }
 }
 
+TEST_CASE( "vehicles linked by power cables share batteries", "[vehicle][power][cable]" )
+{
+    reset_player();
+    build_test_map( ter_id( "t_pavement" ) );
+    clear_vehicles();
+    map &here = get_map();
+
+    vehicle *veh_a = here.add_vehicle( vproto_id( "solar_panel_test" ), tripoint( 5, 5, 0 ),
+                                       0_degrees, 0, 0 );
+    vehicle *veh_b = here.add_vehicle( vproto_id( "solar_panel_test" ), tripoint( 12, 5, 0 ),
+                                       0_degrees, 0, 0 );
+    REQUIRE( veh_a != nullptr );
+    REQUIRE( veh_b != nullptr );
+    veh_a->discharge_battery( veh_a->fuel_left( fuel_type_battery ), false );
+    veh_b->discharge_battery( veh_b->fuel_left( fuel_type_battery ), false );
+    REQUIRE( veh_a->power_grid().empty() );
+
+    // Same as connecting a jumper cable in iuse::cable_attach
+    const vpart_id jumper_cable( "jumper_cable" );
+    const tripoint pos_a = veh_a->global_pos3();
+    const tripoint pos_b = veh_b->global_pos3();
+    vehicle_part part_a( jumper_cable, "", point_zero, item( "jumper_cable" ) );
+    part_a.target.first = here.getabs( pos_b );
+    part_a.target.second = here.getabs( pos_b );
+    const int cable_a = veh_a->install_part( point_zero, part_a );
+    vehicle_part part_b( jumper_cable, "", point_zero, item( "jumper_cable" ) );
+    part_b.target.first = here.getabs( pos_a );
+    part_b.target.second = here.getabs( pos_a );
+    REQUIRE( veh_b->install_part( point_zero, part_b ) >= 0 );
+    REQUIRE( cable_a >= 0 );
+
+    const std::vector<power_grid_node> &grid = veh_a->power_grid();
+    REQUIRE( grid.size() == 1 );
+    CHECK( grid.front().veh == veh_b );
+    CHECK( grid.front().loss == 1 );
+
+    // charge spills over into the connected vehicle
+    const int capacity = veh_a->fuel_capacity( fuel_type_battery );
+    CHECK( veh_a->charge_battery( capacity + 1000 ) == 0 );
+    CHECK( veh_a->fuel_left( fuel_type_battery, false ) == capacity );
+    CHECK( veh_b->fuel_left( fuel_type_battery, false ) == 1000 - 10 );
+    CHECK( veh_a->fuel_left( fuel_type_battery, true ) == capacity + 990 );
+
+    // and is drawn from it when the local batteries run out
+    CHECK( veh_a->discharge_battery( capacity + 100 ) == 0 );
+    CHECK( veh_a->fuel_left( fuel_type_battery, false ) == 0 );
+    CHECK( veh_b->fuel_left( fuel_type_battery, false ) == 990 - 101 );
+
+    WHEN( "the cable is removed" ) {
+        veh_a->remove_remote_part( cable_a );
+        veh_a->remove_part( cable_a );
+        veh_a->part_removal_cleanup();
+        veh_b->part_removal_cleanup();
+        THEN( "the vehicles are no longer connected" ) {
+            CHECK( veh_a->power_grid().empty() );
+            CHECK( veh_b->power_grid().empty() );
+            CHECK( veh_a->discharge_battery( 100 ) == 100 );
+        }
+    }
+}
+
 TEST_CASE( "maximum reverse velocity", "[vehicle][power][reverse]" )
 {
     reset_player();
@@ -315,3 +315,56 @@ TEST_CASE( "vehicle_level_test", "[vehicle][ramp]" )
         test_leveling( veh );
     }
 }
+
+// Recalculating the mount positions of a vehicle that is partly up a ramp must
+// keep the z offsets of its parts, or it gets stuck at the ramp.
+TEST_CASE( "vehicle_ramp_keeps_part_z_offsets", "[vehicle][ramp]" )
+{
+    const int transition_x = 60;
+    clear_game_and_set_ramp( transition_x, true, true );
+    map &here = get_map();
+    const tripoint map_starting_point( transition_x + 4, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vproto_id( "motorcycle" ), map_starting_point,
+                                         180_degrees, 1, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    veh.check_falling_or_floating();
+    veh.tags.insert( "IN_CONTROL_OVERRIDE" );
+    veh.engine_on = true;
+    Character &player_character = get_player_character();
+    player_character.setpos( map_starting_point );
+    here.board_vehicle( map_starting_point, &player_character );
+    REQUIRE( player_character.in_vehicle );
+
+    veh.cruise_velocity = 400;
+    veh.velocity = 400;
+    bool straddled_ramp = false;
+    for( int cycles = 0; cycles < 10; cycles++ ) {
+        CAPTURE( cycles );
+        here.vehmove();
+        std::vector<int> z_offsets;
+        for( const vpart_reference &vp : veh.get_all_parts() ) {
+            z_offsets.push_back( vp.part().precalc[0].z );
+            straddled_ramp |= vp.part().precalc[0].z != 0;
+        }
+        veh.precalc_mounts( 0, veh.pivot_rotation[0], veh.pivot_anchor[0] );
+        size_t i = 0;
+        for( const vpart_reference &vp : veh.get_all_parts() ) {
+            CHECK( vp.part().precalc[0].z == z_offsets[i++] );
+        }
+    }
+    CHECK( straddled_ramp );
+    for( const vpart_reference &vp : veh.get_all_parts() ) {
+        CHECK( vp.pos().z == 1 );
+    }
+
+    const cata::optional<vpart_reference> vp = here.veh_at( player_character.pos() ).part_with_feature(
+                VPFLAG_BOARDABLE, true );
+    REQUIRE( vp );
+    const int z_change = map_starting_point.z - player_character.pos().z;
+    here.unboard_vehicle( *vp, &player_character, false );
+    player_character.setpos( map_starting_point );
+    if( z_change ) {
+        g->vertical_move( z_change, true );
+    }
+}
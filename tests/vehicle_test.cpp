@@ -13,6 +13,8 @@
 #include "type_id.h"
 #include "units.h"
 #include "vehicle.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 
 TEST_CASE( "detaching_vehicle_unboards_passengers" )
 {
@@ -111,3 +113,39 @@ TEST_CASE( "starting_bicycle_damaged_pedal" )
 
     here.detach_vehicle( veh_ptr );
 }
+
+TEST_CASE( "vehicle_turning_and_collision_use_part_mounts", "[vehicle]" )
+{
+    clear_map();
+    map &here = get_map();
+    get_avatar().setpos( tripoint( 10, 10, 0 ) );
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vproto_id( "car" ), vehicle_origin, 0_degrees, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+
+    // every part gets the turned position of its own mount point
+    veh.precalc_mounts( 1, 45_degrees, veh.pivot_point() );
+    for( const vpart_reference &vp : veh.get_all_parts() ) {
+        tripoint expected;
+        veh.coord_translate( 45_degrees, veh.pivot_point(), vp.mount(), expected );
+        CHECK( vp.part().precalc[1] == expected );
+    }
+
+    // nothing is in the way until a wall is built in front of the car
+    veh.precalc_mounts( 1, 0_degrees, veh.pivot_point() );
+    std::vector<veh_collision> colls;
+    CHECK_FALSE( veh.collision( colls, tripoint_east, true ) );
+    tripoint front = veh.global_pos3();
+    for( const vpart_reference &vp : veh.get_all_parts() ) {
+        if( vp.pos().x > front.x ) {
+            front = vp.pos();
+        }
+    }
+    here.ter_set( front + tripoint_east, ter_id( "t_wall" ) );
+    CHECK( veh.collision( colls, tripoint_east, true ) );
+    REQUIRE( colls.size() == 1 );
+    CHECK( colls.front().type == veh_coll_bashable );
+
+    here.destroy_vehicle( veh_ptr );
+}
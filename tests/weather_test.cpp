@@ -342,3 +342,71 @@ TEST_CASE( "local wind chill calculation", "[weather][wind_chill]" )
     }
 }
 
+
+// The way sum_conditions sampled the weather before older weather was looked up in whole days
+static weather_sum sum_conditions_per_step( const time_point &start, const time_point &end,
+        const tripoint &location )
+{
+    weather_sum data;
+    time_duration tick_size = 0_turns;
+    for( time_point t = start; t < end; t += tick_size ) {
+        const time_duration diff = end - t;
+        if( diff < 10_turns ) {
+            tick_size = 1_turns;
+        } else if( diff > 7_days ) {
+            tick_size = 1_hours;
+        } else {
+            tick_size = 1_minutes;
+        }
+        const weather_type_id wtype = current_weather( location, t );
+        const int amount = wtype->rains ? to_turns<int>( tick_size ) *
+                           ( wtype->precip == precip_class::very_light ? 1 :
+                             wtype->precip == precip_class::light ? 4 :
+                             wtype->precip == precip_class::heavy ? 8 : 0 ) : 0;
+        ( wtype->acidic ? data.acid_amount : data.rain_amount ) += amount;
+        data.sunlight += incident_sunlight( wtype, t ) * to_turns<int>( tick_size );
+    }
+    return data;
+}
+
+TEST_CASE( "sum_conditions_matches_per_step_sampling", "[weather]" )
+{
+    scoped_weather_override null_weather( WEATHER_NULL );
+    // the origin of an overmap tile, where the shared timeline samples the weather
+    const tripoint location( 24 * 20, 24 * 30, 0 );
+    const time_point end = calendar::turn_zero + 60_days + 13_hours + 25_minutes;
+
+    SECTION( "short spans are sampled as before" ) {
+        const time_point start = end - 3_days;
+        const weather_sum expected = sum_conditions_per_step( start, end, location );
+        const weather_sum actual = sum_conditions( start, end, location );
+        CHECK( actual.rain_amount == expected.rain_amount );
+        CHECK( actual.acid_amount == expected.acid_amount );
+        CHECK( actual.sunlight == Approx( expected.sunlight ) );
+    }
+
+    SECTION( "a month of absence starting on a full hour" ) {
+        const time_point start = calendar::turn_zero + 20_days + 7_hours;
+        const weather_sum expected = sum_conditions_per_step( start, end, location );
+        const weather_sum actual = sum_conditions( start, end, location );
+        // older weather is sampled on the hour in both cases, it only differs in the sunlight,
+        // which is integrated over the hour instead of being sampled at its start
+        CHECK( actual.rain_amount == Approx( expected.rain_amount ).epsilon( 0.01 ) );
+        CHECK( actual.acid_amount == Approx( expected.acid_amount ).epsilon( 0.01 ) );
+        CHECK( actual.sunlight == Approx( expected.sunlight ).epsilon( 0.05 ) );
+        // the shared timeline gives the same result the second time
+        const weather_sum again = sum_conditions( start, end, location );
+        CHECK( again.rain_amount == actual.rain_amount );
+        CHECK( again.sunlight == Approx( actual.sunlight ) );
+    }
+
+    SECTION( "a month of absence starting in the middle of an hour" ) {
+        const time_point start = calendar::turn_zero + 20_days + 7_hours + 17_minutes;
+        const weather_sum expected = sum_conditions_per_step( start, end, location );
+        const weather_sum actual = sum_conditions( start, end, location );
+        // the weather is sampled at different minutes, so a change of weather may be missed
+        CHECK( actual.rain_amount == Approx( expected.rain_amount ).epsilon( 0.25 ) );
+        CHECK( actual.acid_amount == Approx( expected.acid_amount ).epsilon( 0.25 ) );
+        CHECK( actual.sunlight == Approx( expected.sunlight ).epsilon( 0.05 ) );
+    }
+}